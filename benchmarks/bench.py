@@ -0,0 +1,49 @@
+def nop(*args):
+  return None
+
+def echo(obj):
+  return obj
+
+def add(a, b):
+  return a + b
+
+def kw(a, b=0, c=0):
+  return None
+
+def f1(a):
+  return a
+
+def f3(a, b, c):
+  return a
+
+def f6(a, b, c, d, e, f):
+  return a
+
+class Counter:
+  def __init__(self):
+    self.count = 0
+
+  def get(self):
+    return self.count
+
+  def add(self, a):
+    self.count += a
+
+def scale(a, b, c):
+  return a * b
+
+def split(a):
+  return "label", a, 0.5
+
+def count_primes(n):
+  count = 0
+  for i in range(2, n):
+    if all(i % j for j in range(2, int(i ** 0.5) + 1)):
+      count += 1
+  return count
+
+tenants = {}
+
+def tenant_task(key, n):
+  tenants[key] = tenants.get(key, 0) + count_primes(n)
+  return tenants[key]
@@ -0,0 +1,31 @@
+#include "bench_root.h"
+
+int main() {
+  {
+    auto module = BenchInit();
+    auto name = Name("echo");
+    auto cache = AttributeCache(module);
+    const size_t n = 1'000'000;
+
+    std::printf("------ attribute lookup ------\n");
+    Bench("GetAttribute(std::string)", n, [&]() {
+      module.GetAttribute("echo");
+    });
+    Bench("GetAttribute(Name)", n, [&]() {
+      module.GetAttribute(name);
+    });
+    Bench("ContainsAttribute(std::string)", n, [&]() {
+      module.ContainsAttribute("echo");
+    });
+    Bench("ContainsAttribute(Name)", n, [&]() {
+      module.ContainsAttribute(name);
+    });
+    Bench("AttributeCache::Get(std::string)", n, [&]() {
+      cache.Get("echo");
+    });
+    Bench("AttributeCache::Get(Name)", n, [&]() {
+      cache.Get(name);
+    });
+  }
+  Finalize();
+}
@@ -0,0 +1,47 @@
+#include "bench_root.h"
+#include <thread>
+
+int main() {
+  {
+    auto module = BenchInit();
+    auto f1 = module.GetAttribute("f1").ToFunc();
+    const size_t total = 1 << 18;
+
+    GILContext context;
+    std::thread th([&context, &f1, &total]() {
+      std::printf("------ per-item locking vs Map (items/s) ------\n");
+      std::printf("%-10s %16s %16s\n", "batch", "per-item lock", "Map");
+      for (size_t batch = 1; batch <= 4096; batch *= 4) {
+        std::vector<double> inputs(batch, 0.5);
+        std::vector<double> outputs;
+        outputs.reserve(batch);
+        auto rounds = total / batch;
+
+        auto start = std::chrono::steady_clock::now();
+        for (size_t r = 0; r < rounds; ++r) {
+          outputs.clear();
+          for (const auto& x : inputs) {
+            context.Lock();
+            outputs.push_back(f1(Float(x)).ToValue().ToFloat());
+            context.Unlock();
+          }
+        }
+        auto locked = std::chrono::duration<double>(
+          std::chrono::steady_clock::now() - start).count();
+
+        start = std::chrono::steady_clock::now();
+        for (size_t r = 0; r < rounds; ++r) {
+          f1.Map(inputs, outputs);
+        }
+        auto batched = std::chrono::duration<double>(
+          std::chrono::steady_clock::now() - start).count();
+
+        std::printf("%-10zu %16.0f %16.0f\n",
+          batch, rounds * batch / locked, rounds * batch / batched);
+      }
+    });
+    th.join();
+    context.Release();
+  }
+  Finalize();
+}
@@ -0,0 +1,63 @@
+#include "bench_root.h"
+
+int main() {
+  {
+    BenchInit();
+    const size_t side = 512;
+    std::vector<double> values(side * side, 1.0);
+    auto buf = Buffer::FromMemory(values.data(), { side, side });
+    auto transposed = Buffer::FromMemory(
+      values.data(), { side, side }, { 8, static_cast<std::ptrdiff_t>(8 * side) });
+    const size_t n = 200;
+    volatile double sink = 0;
+
+    std::printf("------ sum of %zux%zu float64 ------\n", side, side);
+    Bench("Data() + Shape() per row", n, [&]() {
+      auto data = buf.Data<double>();
+      double sum = 0;
+      for (size_t y = 0; y < buf.Shape()[0]; ++y) {
+        for (size_t x = 0; x < buf.Shape()[1]; ++x) {
+          sum += data[y * buf.Shape()[1] + x];
+        }
+      }
+      sink = sum;
+    });
+    Bench("BufferView operator()", n, [&]() {
+      BufferView<const double, 2> view(buf);
+      double sum = 0;
+      for (size_t y = 0; y < view.Shape(0); ++y) {
+        for (size_t x = 0; x < view.Shape(1); ++x) {
+          sum += view(y, x);
+        }
+      }
+      sink = sum;
+    });
+    Bench("BufferView iterator", n, [&]() {
+      BufferView<const double, 2> view(buf);
+      double sum = 0;
+      for (const auto& v : view) {
+        sum += v;
+      }
+      sink = sum;
+    });
+    Bench("BufferView Flat()", n, [&]() {
+      BufferView<const double, 2> view(buf);
+      double sum = 0;
+      for (const auto& v : view.Flat()) {
+        sum += v;
+      }
+      sink = sum;
+    });
+    Bench("BufferView operator() (transposed)", n, [&]() {
+      BufferView<const double, 2> view(transposed);
+      double sum = 0;
+      for (size_t y = 0; y < view.Shape(0); ++y) {
+        for (size_t x = 0; x < view.Shape(1); ++x) {
+          sum += view(y, x);
+        }
+      }
+      sink = sum;
+    });
+  }
+  Finalize();
+}
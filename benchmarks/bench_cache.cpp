@@ -0,0 +1,34 @@
+#include "bench_root.h"
+
+int main() {
+  {
+    BenchInit();
+    const std::vector<std::string> labels = { "train", "valid", "test", "unknown" };
+    const size_t n = 1'000'000;
+
+    auto run = [&](const char* title) {
+      std::printf("------ %s ------\n", title);
+      Bench("Int(500)", n, []() {
+        auto v = Int(500);
+      });
+      Bench("Str(label)", n, [&labels]() {
+        static size_t i = 0;
+        auto v = Str(labels[i++ % labels.size()]);
+      });
+      Bench("Dict.Set(Str(label), Int(i % 1000))", n, [&labels]() {
+        static auto dict = Dict();
+        static size_t i = 0;
+        dict.Set(Str(labels[i % labels.size()]), Int(i % 1000));
+        ++i;
+      });
+    };
+
+    run("value cache disabled");
+    EnableValueCache();
+    run("value cache enabled");
+    auto stats = GetValueCacheStats();
+    std::printf("int hits/misses: %zu/%zu, string hits/misses: %zu/%zu\n",
+      stats.int_hits, stats.int_misses, stats.string_hits, stats.string_misses);
+  }
+  Finalize();
+}
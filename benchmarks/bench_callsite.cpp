@@ -0,0 +1,40 @@
+#include "bench_root.h"
+
+int main() {
+  {
+    auto module = BenchInit();
+    auto f1 = module.GetAttribute("f1").ToFunc();
+    auto f3 = module.GetAttribute("f3").ToFunc();
+    auto f6 = module.GetAttribute("f6").ToFunc();
+    const size_t n = 1'000'000;
+    double x = 0.5;
+
+    std::printf("------ Func::operator() ------\n");
+    Bench("1 arg", n, [&]() {
+      f1(Float(x)).ToValue().ToFloat();
+    });
+    Bench("3 args", n, [&]() {
+      f3(Float(x), Int(1), Float(x)).ToValue().ToFloat();
+    });
+    Bench("6 args", n, [&]() {
+      f6(Float(x), Int(1), Float(x), Int(2), Float(x), Int(3)).ToValue().ToFloat();
+    });
+
+    std::printf("------ CallSite ------\n");
+    auto s1 = CallSite(f1, 1);
+    Bench("1 arg", n, [&]() {
+      s1.SetFloat(0, x).Invoke().ToValue().ToFloat();
+    });
+    auto s3 = CallSite(f3, 3);
+    Bench("3 args", n, [&]() {
+      s3.SetFloat(0, x).SetInt(1, 1).SetFloat(2, x).Invoke().ToValue().ToFloat();
+    });
+    auto s6 = CallSite(f6, 6);
+    Bench("6 args", n, [&]() {
+      s6.SetFloat(0, x).SetInt(1, 1).SetFloat(2, x)
+        .SetInt(3, 2).SetFloat(4, x).SetInt(5, 3)
+        .Invoke().ToValue().ToFloat();
+    });
+  }
+  Finalize();
+}
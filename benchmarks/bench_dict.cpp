@@ -0,0 +1,61 @@
+#include "bench_root.h"
+
+int main() {
+  {
+    BenchInit();
+    auto dict = Dict();
+    for (int i = 0; i < 64; ++i) {
+      dict.Set("feature_" + std::to_string(i), Int(i));
+    }
+    const std::string key = "feature_42";
+    const auto object_key = Str(key);
+    const size_t n = 1'000'000;
+
+    std::printf("------ Dict lookup (64 string keys) ------\n");
+    Bench("Get(std::string)", n, [&]() {
+      auto v = dict.Get(key);
+    });
+    Bench("Get(const char*, size_t)", n, [&]() {
+      auto v = dict.Get(key.data(), key.size());
+    });
+    Bench("Get(Object)", n, [&]() {
+      auto v = dict.Get(object_key);
+    });
+    Bench("TryGet(std::string) hit", n, [&]() {
+      auto v = dict.TryGet(key);
+    });
+    Bench("TryGet(std::string) miss", n, [&]() {
+      auto v = dict.TryGet("missing");
+    });
+    Bench("Contains(std::string)", n, [&]() {
+      dict.Contains(key);
+    });
+    Bench("Set + Delete(std::string)", n, [&]() {
+      dict.Set("tmp", object_key);
+      dict.Delete("tmp");
+    });
+
+    auto large = Dict();
+    for (int i = 0; i < 5000; ++i) {
+      large.Set("key_" + std::to_string(i), Int(i));
+    }
+    const size_t m = 1'000;
+
+    std::printf("------ Dict walk (5000 entries) ------\n");
+    Bench("GetKeys() + Get(key)", m, [&]() {
+      for (const auto& key : large.GetKeys().ToStdVector()) {
+        auto v = large.Get(key);
+      }
+    });
+    Bench("ToStdVector()", m, [&]() {
+      auto v = large.ToStdVector();
+    });
+    Bench("range-for ObjectView", m, [&]() {
+      size_t count = 0;
+      for (const auto& kv : large) {
+        count += kv.second.GetRef() != nullptr;
+      }
+    });
+  }
+  Finalize();
+}
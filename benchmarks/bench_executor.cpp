@@ -0,0 +1,59 @@
+#include "bench_root.h"
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+// per-request latency of many threads calling Python: direct GIL locking
+// vs handing requests to one GIL-holding executor thread
+template<typename F>
+auto Measure(const char* name, const size_t& threads, const size_t& requests, F&& request) -> void {
+  std::vector<std::vector<double>> latencies(threads);
+  auto start = std::chrono::steady_clock::now();
+  std::vector<std::thread> workers;
+  for (size_t t = 0; t < threads; ++t) {
+    workers.emplace_back([&, t]() {
+      latencies[t].reserve(requests / threads);
+      for (size_t i = 0; i < requests / threads; ++i) {
+        auto begin = std::chrono::steady_clock::now();
+        request();
+        auto end = std::chrono::steady_clock::now();
+        latencies[t].push_back(std::chrono::duration<double, std::micro>(end - begin).count());
+      }
+    });
+  }
+  for (auto& w : workers) {
+    w.join();
+  }
+  auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  std::vector<double> all;
+  for (const auto& l : latencies) {
+    all.insert(all.end(), l.begin(), l.end());
+  }
+  std::sort(all.begin(), all.end());
+  std::printf("%-24s p50 %9.1f us  p99 %9.1f us  %10.0f requests/s\n",
+    name, all[all.size() / 2], all[all.size() * 99 / 100], all.size() / elapsed);
+}
+
+int main() {
+  {
+    auto module = BenchInit();
+    auto add = module.GetAttribute("add").ToFunc().Typed<long(long, long)>();
+    const size_t requests = 25600;
+    GILExecutor executor;
+    GILContext context;
+
+    for (size_t threads = 1; threads <= 64; threads *= 2) {
+      std::printf("------ %zu submitter threads ------\n", threads);
+      Measure("GILContext::Lock", threads, requests, [&]() {
+        context.Lock();
+        add(1, 2);
+        context.Unlock();
+      });
+      Measure("GILExecutor::Submit", threads, requests, [&]() {
+        executor.Submit([&]() { return add(1, 2); }).get();
+      });
+    }
+    context.Release();
+  }
+  Finalize();
+}
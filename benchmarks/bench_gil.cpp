@@ -0,0 +1,64 @@
+#include "bench_root.h"
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+// first GIL acquisition on fresh threads, in microseconds
+template<typename F>
+auto FirstAcquire(const char* name, const bool& registered, F&& acquire) -> void {
+  const size_t threads = 200;
+  std::vector<double> latencies;
+  for (size_t t = 0; t < threads; ++t) {
+    std::thread th([&]() {
+      std::unique_ptr<ThreadRegistration> registration;
+      if (registered) {
+        registration.reset(new ThreadRegistration());
+      }
+      auto begin = std::chrono::steady_clock::now();
+      acquire();
+      auto end = std::chrono::steady_clock::now();
+      latencies.push_back(std::chrono::duration<double, std::micro>(end - begin).count());
+    });
+    th.join();
+  }
+  std::sort(latencies.begin(), latencies.end());
+  std::printf("%-40s p50 %8.2f us  p99 %8.2f us\n",
+    name, latencies[threads / 2], latencies[threads * 99 / 100]);
+}
+
+int main() {
+  {
+    BenchInit();
+    const size_t n = 200000;
+    GILContext context;
+
+    std::printf("------ repeated acquire/release on one thread ------\n");
+    std::thread([&]() {
+      Bench("GILContext::Lock/Unlock", n, [&]() {
+        context.Lock();
+        context.Unlock();
+      });
+      Bench("GILAcquire", n, [&]() {
+        GILAcquire acquire;
+      });
+      ThreadRegistration registration;
+      Bench("GILContext::Lock/Unlock (registered)", n, [&]() {
+        context.Lock();
+        context.Unlock();
+      });
+      Bench("GILAcquire (registered)", n, [&]() {
+        GILAcquire acquire;
+      });
+    }).join();
+
+    std::printf("------ first acquisition on a new thread ------\n");
+    FirstAcquire("GILAcquire", false, []() {
+      GILAcquire acquire;
+    });
+    FirstAcquire("GILAcquire (registered)", true, []() {
+      GILAcquire acquire;
+    });
+    context.Release();
+  }
+  Finalize();
+}
@@ -0,0 +1,28 @@
+#include "bench_root.h"
+
+int main() {
+  {
+    auto module = BenchInit();
+    auto nop = module.GetAttribute("nop").ToFunc();
+    auto a = Int(1);
+    const size_t n = 1'000'000;
+
+    std::printf("------ Func::operator() ------\n");
+    Bench("0 args", n, [&]() { nop(); });
+    Bench("1 args", n, [&]() { nop(a); });
+    Bench("2 args", n, [&]() { nop(a, a); });
+    Bench("3 args", n, [&]() { nop(a, a, a); });
+    Bench("4 args", n, [&]() { nop(a, a, a, a); });
+    Bench("5 args", n, [&]() { nop(a, a, a, a, a); });
+    Bench("6 args", n, [&]() { nop(a, a, a, a, a, a); });
+    Bench("7 args", n, [&]() { nop(a, a, a, a, a, a, a); });
+    Bench("8 args", n, [&]() { nop(a, a, a, a, a, a, a, a); });
+
+    std::printf("------ PyObject_CallObject (reference) ------\n");
+    auto args = Tuple(a, a, a, a);
+    Bench("4 args (prebuilt tuple)", n, [&]() {
+      Py_DECREF(PyObject_CallObject(PYOBJ_REF(&nop), PYOBJ_REF(&args)));
+    });
+  }
+  Finalize();
+}
@@ -0,0 +1,38 @@
+#include "bench_root.h"
+
+int main() {
+  {
+    auto module = BenchInit();
+    auto kw = module.GetAttribute("kw").ToFunc();
+    auto a = Int(1);
+    auto b = Int(2);
+    auto c = Int(3);
+    const size_t n = 1'000'000;
+
+    std::printf("------ keyword arguments ------\n");
+    auto keywords = Keywords("b", "c");
+    Bench("InvokeWithKeywords (cached names)", n, [&]() {
+      kw.InvokeWithKeywords(keywords, a, b, c);
+    });
+    Bench("InvokeWithKeywords (new names)", n, [&]() {
+      kw.InvokeWithKeywords(Keywords("b", "c"), a, b, c);
+    });
+
+    std::printf("------ PyObject_Call with dict (reference) ------\n");
+    auto args = Tuple(a);
+    Bench("PyObject_Call (new dict)", n, [&]() {
+      auto kwargs = PyDict_New();
+      PyDict_SetItemString(kwargs, "b", PYOBJ_REF(&b));
+      PyDict_SetItemString(kwargs, "c", PYOBJ_REF(&c));
+      Py_DECREF(PyObject_Call(PYOBJ_REF(&kw), PYOBJ_REF(&args), kwargs));
+      Py_DECREF(kwargs);
+    });
+    auto kwargs = Dict();
+    kwargs.Set("b", b);
+    kwargs.Set("c", c);
+    Bench("PyObject_Call (prebuilt dict)", n, [&]() {
+      Py_DECREF(PyObject_Call(PYOBJ_REF(&kw), PYOBJ_REF(&args), PYOBJ_REF(&kwargs)));
+    });
+  }
+  Finalize();
+}
@@ -0,0 +1,71 @@
+#include "bench_root.h"
+
+int main() {
+  {
+    BenchInit();
+    const size_t size = 1'000'000;
+    auto list = Import("builtins").GetAttribute("list").ToFunc()(
+      Import("builtins").GetAttribute("range").ToFunc()(Int(size))).ToList();
+    const size_t n = 20;
+    // keeps the loops observable to the optimizer
+    volatile size_t sink = 0;
+
+    std::printf("------ List walk (%zu elements) ------\n", size);
+    Bench("ToStdVector()", n, [&]() {
+      size_t count = 0;
+      for (const auto& item : list.ToStdVector()) {
+        count += reinterpret_cast<size_t>(item.GetRef());
+      }
+      sink = count;
+    });
+    Bench("Get(i)", n, [&]() {
+      size_t count = 0;
+      for (size_t i = 0; i < size; ++i) {
+        count += reinterpret_cast<size_t>(list.Get(static_cast<int>(i)).GetRef());
+      }
+      sink = count;
+    });
+    Bench("operator[](i)", n, [&]() {
+      size_t count = 0;
+      for (size_t i = 0; i < size; ++i) {
+        count += reinterpret_cast<size_t>(list[i].GetRef());
+      }
+      sink = count;
+    });
+    Bench("range-for ObjectView", n, [&]() {
+      size_t count = 0;
+      for (const auto& item : list) {
+        count += reinterpret_cast<size_t>(item.GetRef());
+      }
+      sink = count;
+    });
+
+    const size_t features = 100'000;
+    std::vector<double> values(features, 0.5);
+    auto floats = List::From(values);
+    const size_t m = 200;
+
+    std::printf("------ List <-> std::vector<double> (%zu elements) ------\n", features);
+    Bench("ToStdVector() + ToValue().ToFloat()", m, [&]() {
+      std::vector<double> v;
+      v.reserve(features);
+      for (const auto& item : floats.ToStdVector()) {
+        v.push_back(item.ToValue().ToFloat());
+      }
+      sink = v.size();
+    });
+    Bench("ToVector<double>()", m, [&]() {
+      sink = floats.ToVector<double>().size();
+    });
+    Bench("List() + Append(Float(x))", m, [&]() {
+      auto list = List();
+      for (const auto& value : values) {
+        list.Append(Float(value));
+      }
+    });
+    Bench("List::From(std::vector<double>)", m, [&]() {
+      auto list = List::From(values);
+    });
+  }
+  Finalize();
+}
@@ -0,0 +1,29 @@
+#include "bench_root.h"
+
+int main() {
+  {
+    BenchInit();
+    auto numpy = Import("numpy");
+    auto frombuffer = numpy.GetAttribute("frombuffer").ToFunc();
+    auto asarray = numpy.GetAttribute("asarray").ToFunc();
+    auto dtype = Str("float64");
+    const size_t n = 1000;
+
+    for (const size_t side : { size_t(16), size_t(256), size_t(1024) }) {
+      std::vector<double> values(side * side, 1.0);
+      std::printf("------ %zux%zu float64 ------\n", side, side);
+      Bench("ByteArray + frombuffer + reshape", n, [&]() {
+        auto buf = ByteArray<double>(values);
+        auto array = frombuffer(buf, dtype)
+          .GetAttribute("reshape").ToFunc()(Tuple(Int(side), Int(side)));
+      });
+      Bench("FromMemory + asarray", n, [&]() {
+        auto array = asarray(Buffer::FromMemory(values.data(), { side, side }));
+      });
+      Bench("FromVector + asarray", n, [&]() {
+        auto array = asarray(Buffer::FromVector(std::vector<double>(values), { side, side }));
+      });
+    }
+  }
+  Finalize();
+}
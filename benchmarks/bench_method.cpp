@@ -0,0 +1,27 @@
+#include "bench_root.h"
+
+int main() {
+  {
+    auto module = BenchInit();
+    auto counter = module.GetAttribute("Counter").ToFunc()();
+    auto a = Int(1);
+    const size_t n = 1'000'000;
+
+    std::printf("------ GetAttribute + ToFunc ------\n");
+    Bench("get()", n, [&]() {
+      counter.GetAttribute("get").ToFunc()();
+    });
+    Bench("add(a)", n, [&]() {
+      counter.GetAttribute("add").ToFunc()(a);
+    });
+
+    std::printf("------ CallMethod ------\n");
+    Bench("get()", n, [&]() {
+      counter.CallMethod("get");
+    });
+    Bench("add(a)", n, [&]() {
+      counter.CallMethod("add", a);
+    });
+  }
+  Finalize();
+}
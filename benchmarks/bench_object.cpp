@@ -0,0 +1,49 @@
+#include "bench_root.h"
+
+int main() {
+  {
+    auto module = BenchInit();
+    auto echo = module.GetAttribute("echo").ToFunc();
+    auto value = Int(2);
+    const size_t n = 1'000'000;
+    volatile long sink = 0;
+
+    std::printf("------ Object handle ------\n");
+    std::printf("sizeof(Object): %zu bytes\n", sizeof(Object));
+    Bench("Int(2)", n, []() {
+      auto v = Int(2);
+    });
+    Bench("Float(0.5)", n, []() {
+      auto v = Float(0.5);
+    });
+    Bench("copy Value", n, [&value]() {
+      auto v = value;
+    });
+    Bench("Func(Int(2))", n, [&echo]() {
+      auto ret = echo(Int(2));
+    });
+    Bench("Func(Int(2)).ToValue().ToInt()", n, [&echo, &sink]() {
+      sink = echo(Int(2)).ToValue().ToInt();
+    });
+    Bench("GetAttribute(\"echo\").ToFunc()", n, [&module]() {
+      auto f = module.GetAttribute("echo").ToFunc();
+    });
+
+    std::printf("------ copy / move ------\n");
+    Bench("Value(Generic) copy", n, [&echo, &value]() {
+      auto ret = echo(value);
+      auto v = ret.ToValue();
+    });
+    Bench("Value(Generic&&) move", n, [&echo, &value]() {
+      auto v = echo(value).ToValue();
+    });
+    auto list = List();
+    for (int i = 0; i < 100; ++i) {
+      list.Append(Int(i));
+    }
+    Bench("List(100).ToStdVector()", n / 100, [&list]() {
+      auto v = list.ToStdVector();
+    });
+  }
+  Finalize();
+}
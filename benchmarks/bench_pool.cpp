@@ -0,0 +1,54 @@
+#include "bench_root.h"
+#include <thread>
+#include <vector>
+
+// CPU-bound calls spread over threads sharing the GIL vs an interpreter pool
+int main() {
+  {
+    auto module = BenchInit();
+    auto count_primes = module.GetAttribute("count_primes").ToFunc();
+    const size_t tasks = 64;
+    const long n = 5000;
+    auto max_threads = std::max(4u, std::thread::hardware_concurrency());
+    std::printf("own GIL per interpreter: %s\n", InterpreterPool::HasOwnGIL() ? "yes" : "no");
+
+    for (size_t threads = 1; threads <= max_threads; threads *= 2) {
+      std::printf("------ %zu threads, %zu tasks ------\n", threads, tasks);
+      auto shared = Bench("GILContext threads", 1, [&]() {
+        GILContext context;
+        std::vector<std::thread> workers;
+        for (size_t t = 0; t < threads; ++t) {
+          workers.emplace_back([&, t]() {
+            for (size_t i = t; i < tasks; i += threads) {
+              context.Scope([&]() { count_primes(Int(n)); });
+            }
+          });
+        }
+        for (auto& w : workers) {
+          w.join();
+        }
+      });
+
+      InterpreterPoolConfig config;
+      config.workers = threads;
+      config.modules = { "bench" };
+      InterpreterPool pool(config);
+      GILContext context;
+      auto pooled = Bench("InterpreterPool", 1, [&]() {
+        std::vector<std::future<long>> results;
+        for (size_t i = 0; i < tasks; ++i) {
+          results.push_back(pool.Submit([n](Interpreter& interpreter) {
+            return interpreter.Function("bench", "count_primes").Typed<long(long)>()(n);
+          }));
+        }
+        for (auto& r : results) {
+          r.get();
+        }
+      });
+      context.Release();
+      std::printf("tasks/s: GILContext %.1f, InterpreterPool %.1f\n",
+        tasks * 1e9 / shared.ns_per_call, tasks * 1e9 / pooled.ns_per_call);
+    }
+  }
+  Finalize();
+}
@@ -0,0 +1,75 @@
+#include "poppy.h"
+#include <Python.h>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+using namespace poppy;
+
+// count every C++ heap allocation made by the process
+static std::atomic<size_t> g_allocations(0);
+
+auto operator new(size_t size) -> void* {
+  g_allocations++;
+  if (auto ptr = std::malloc(size ? size : 1)) {
+    return ptr;
+  }
+  throw std::bad_alloc();
+}
+
+auto operator delete(void* ptr) noexcept -> void {
+  std::free(ptr);
+}
+
+auto operator delete(void* ptr, size_t) noexcept -> void {
+  std::free(ptr);
+}
+
+/**
+ * @brief measurement result of one benchmark case
+ */
+struct BenchResult {
+  double ns_per_call;
+  double allocations_per_call;
+};
+
+/**
+ * @brief run a function repeatedly and measure time and C++ allocations
+ * @param[in] name label printed with the result
+ * @param[in] iterations number of calls
+ * @param[in] func function to measure
+ * @return BenchResult measured result
+ */
+template<typename F>
+inline auto Bench(const char* name, const size_t& iterations, F&& func) -> BenchResult {
+  for (size_t i = 0; i < iterations / 10 + 1; ++i) {
+    func();
+  }
+  auto allocations = g_allocations.load();
+  auto start = std::chrono::steady_clock::now();
+  for (size_t i = 0; i < iterations; ++i) {
+    func();
+  }
+  auto end = std::chrono::steady_clock::now();
+  auto elapsed = std::chrono::duration<double, std::nano>(end - start).count();
+  BenchResult result {
+    elapsed / iterations,
+    static_cast<double>(g_allocations.load() - allocations) / iterations
+  };
+  std::printf("%-40s %10.1f ns/call %10.2f allocs/call %12.0f calls/s\n",
+    name, result.ns_per_call, result.allocations_per_call,
+    1e9 / result.ns_per_call);
+  return result;
+}
+
+/**
+ * @brief initialize interpreter and load benchmark script
+ * @return Object benchmark script module
+ */
+inline auto BenchInit() -> Object {
+  Initialize();
+  AddModuleDirectory(BENCH_SCRIPT_DIR);
+  return Import("bench");
+}
@@ -0,0 +1,52 @@
+#include "bench_root.h"
+#include <string>
+#include <thread>
+#include <vector>
+
+// skewed per-key load routed by key, with and without hot-key rebalancing
+int main() {
+  {
+    BenchInit();
+    const size_t tasks = 512;
+    const long n = 500;
+    size_t shards = std::max<size_t>(4, std::thread::hardware_concurrency());
+    // a few keys share most of the load and collide on one shard
+    std::vector<std::string> keys;
+    for (size_t i = 0; i < tasks; ++i) {
+      keys.push_back("tenant" + std::to_string(i % 4 == 0 ? i % 3 : i % 64));
+    }
+    std::printf("own GIL per interpreter: %s\n", InterpreterPool::HasOwnGIL() ? "yes" : "no");
+
+    for (const size_t& interval : { size_t(0), size_t(64) }) {
+      ShardedExecutorConfig config;
+      config.pool.workers = shards;
+      config.pool.modules = { "bench" };
+      config.hash = [](const std::string& key) {
+        return key < "tenant3" ? size_t(0) : std::hash<std::string>()(key);
+      };
+      config.rebalance_interval = interval;
+      config.max_moves = 2;
+      ShardedExecutor executor(config);
+      GILContext context;
+      std::printf("------ %zu shards, rebalance every %zu ------\n", shards, interval);
+      Bench(interval ? "ShardedExecutor (rebalanced)" : "ShardedExecutor (static)", 1, [&]() {
+        std::vector<std::future<long>> results;
+        for (const auto& key : keys) {
+          results.push_back(executor.Submit(key, [key, n](Interpreter& interpreter) {
+            return interpreter.Function("bench", "tenant_task").Typed<long(std::string, long)>()(key, n);
+          }));
+        }
+        for (auto& r : results) {
+          r.get();
+        }
+      });
+      auto stats = executor.Stats();
+      for (size_t i = 0; i < stats.size(); ++i) {
+        std::printf("shard %zu: submitted %zu, max depth %zu, keys moved in %zu\n",
+          i, stats[i].submitted, stats[i].max_depth, stats[i].keys_moved_in);
+      }
+      context.Release();
+    }
+  }
+  Finalize();
+}
@@ -0,0 +1,69 @@
+#include "bench_root.h"
+
+int main() {
+  {
+    auto module = BenchInit();
+    auto scale = module.GetAttribute("scale").ToFunc();
+    auto split = module.GetAttribute("split").ToFunc();
+    auto typed_scale = scale.Typed<double(long, double, std::string)>();
+    auto typed_split = split.Typed<std::tuple<std::string, long, double>(long)>();
+    const std::string label = "label";
+    const size_t n = 1'000'000;
+    volatile double sink = 0;
+
+    std::printf("------ double(long, double, std::string) ------\n");
+    Bench("Func(Int, Float, Str).ToValue().ToFloat()", n, [&]() {
+      sink = scale(Int(3), Float(0.5), Str(label)).ToValue().ToFloat();
+    });
+    Bench("TypedFunc", n, [&]() {
+      sink = typed_scale(3, 0.5, label);
+    });
+
+    std::printf("------ std::tuple<std::string, long, double>(long) ------\n");
+    Bench("Func(Int).ToTuple() + Get(i)", n, [&]() {
+      auto ret = split(Int(3)).ToTuple();
+      auto result = std::make_tuple(
+        ret.Get(0).ToValue().ToString(),
+        ret.Get(1).ToValue().ToInt(),
+        ret.Get(2).ToValue().ToFloat());
+      sink = std::get<2>(result);
+    });
+    Bench("Func(Int).Unpack<...>()", n, [&]() {
+      sink = std::get<2>(split(Int(3)).Unpack<std::string, long, double>());
+    });
+    Bench("TypedFunc", n, [&]() {
+      sink = std::get<2>(typed_split(3));
+    });
+
+    auto echo = module.GetAttribute("echo").ToFunc();
+    auto rows = std::vector<std::vector<double>>(100, std::vector<double>(10, 0.5));
+    auto typed_echo = echo.Typed<
+      std::vector<std::vector<double>>(std::vector<std::vector<double>>)>();
+    const size_t m = 10'000;
+
+    std::printf("------ std::vector<std::vector<double>> (100 x 10) round trip ------\n");
+    Bench("List(Float) + ToStdVector() + ToFloat()", m, [&]() {
+      auto list = List();
+      for (const auto& row : rows) {
+        auto inner = List();
+        for (const auto& value : row) {
+          inner.Append(Float(value));
+        }
+        list.Append(inner);
+      }
+      std::vector<std::vector<double>> result;
+      for (const auto& row : echo(list).ToList().ToStdVector()) {
+        std::vector<double> values;
+        for (const auto& value : row.ToList().ToStdVector()) {
+          values.push_back(value.ToValue().ToFloat());
+        }
+        result.push_back(std::move(values));
+      }
+      sink = result[0][0];
+    });
+    Bench("TypedFunc", m, [&]() {
+      sink = typed_echo(rows)[0][0];
+    });
+  }
+  Finalize();
+}
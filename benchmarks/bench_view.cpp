@@ -0,0 +1,44 @@
+#include "bench_root.h"
+#include <string_view>
+
+int main() {
+  {
+    BenchInit();
+    const std::string payload(4 * 1024 * 1024, 'x');
+    auto bytes = Value::FromBytes(payload.data(), payload.size());
+    auto text = Str(payload);
+    const size_t n = 200;
+    volatile size_t sink = 0;
+
+    std::printf("------ 4 MiB payload ------\n");
+    Bench("ToBytes()", n, [&]() {
+      sink = bytes.ToBytes().size();
+    });
+    Bench("ToBytesView()", n, [&]() {
+      sink = bytes.ToBytesView().size();
+    });
+    Bench("ToString()", n, [&]() {
+      sink = text.ToString().size();
+    });
+    Bench("ToStringView()", n, [&]() {
+      sink = text.ToStringView().size();
+    });
+    Bench("std::hash(ToString())", n, [&]() {
+      sink = std::hash<std::string>()(text.ToString());
+    });
+    Bench("std::hash(ToStringView())", n, [&]() {
+      sink = std::hash<std::string_view>()(text.ToStringView());
+    });
+
+    const char* key = "feature_name_0123456789";
+    const size_t m = 1'000'000;
+    std::printf("------ FromString ------\n");
+    Bench("FromString(std::string(ptr, len))", m, [&]() {
+      auto v = Value::FromString(std::string(key, 16));
+    });
+    Bench("FromString(ptr, len)", m, [&]() {
+      auto v = Value::FromString(key, 16);
+    });
+  }
+  Finalize();
+}
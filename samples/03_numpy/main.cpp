@@ -25,19 +25,17 @@ int main() {
   auto c2py = module.GetAttribute("c2py").ToFunc();
   auto py2c = module.GetAttribute("py2c").ToFunc();
 
-  // set arguments
-  auto buf = ByteArray<double>(
-    {
+  // set arguments (ownership moves to Python, no copy)
+  auto buf = Buffer::FromVector(
+    std::vector<double>{
       1, 0, 0,
-      2, 1, 0 
-    }
+      2, 1, 0
+    },
+    { 2, 3 }
   );
 
   // run function (1)
-  auto ndarray =
-    numpy
-      .GetAttribute("frombuffer").ToFunc()(buf, Str("float64"))
-      .GetAttribute("reshape").ToFunc()(Tuple(Int(2), Int(3)));
+  auto ndarray = numpy.GetAttribute("asarray").ToFunc()(buf);
   c2py(ndarray);
 
   // run function (2)
@@ -63,13 +61,13 @@ int main() {
   }
   cout << "]" << endl;
 
-  // print matrix
-  auto data = val.Data<double>();
+  // print matrix (stride-aware, works for non-contiguous arrays too)
+  BufferView<const double, 2> mat(val);
   cout << fixed << setprecision(1) << endl;
-  for (int y = 0; y < shape[0]; ++y) {
+  for (size_t y = 0; y < mat.Shape(0); ++y) {
     cout << "> ";
-    for (int x = 0; x < shape[1]; ++x) {
-      auto num = static_cast<double>(data[y * shape[1] + x]);
+    for (size_t x = 0; x < mat.Shape(1); ++x) {
+      auto num = mat(y, x);
       cout << (num >= 0 ? "+" : "-") << abs(num) << "  ";
     }
     cout << endl;
@@ -17,15 +17,11 @@ int main() {
   // instance class object
   auto hoge = module.GetAttribute("new").ToFunc()();
 
-  // get class method
-  auto get = hoge.GetAttribute("get").ToFunc();
-  auto set = hoge.GetAttribute("set").ToFunc();
+  // run method (1)
+  hoge.CallMethod("set", Int(500));
 
-  // run function (1)
-  set(Int(500));
-
-  // run function (2)
-  auto val = get().ToValue();
+  // run method (2)
+  auto val = hoge.CallMethod("get").ToValue();
 
   // print results
   cout << "------ Python -> C++ ------" << endl;
@@ -5,12 +5,24 @@
 #define PYOBJ_REF(item) reinterpret_cast<PyObject*>((item)->GetRef())
 
 #include <string>
+#include <string_view>
+#include <array>
+#include <map>
 #include <vector>
 #include <iostream>
 #include <unordered_map>
 #include <stdexcept>
 #include <typeinfo>
 #include <functional>
+#include <future>
+#include <memory>
+#include <limits>
+#include <iterator>
+#include <cstddef>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
 
 /**
  * @brief namespace of the C++ API for Python interpreter control
@@ -24,7 +36,32 @@ class Tuple;
 class List;
 class Dict;
 class Buffer;
+template<typename T, size_t N>
+class BufferView;
+class Keywords;
 class Func;
+class Name;
+class CallSite;
+class ObjectView;
+
+/**
+ * @brief compile-time converter from C++ value into Python object
+ * @note specialize with 'static auto Convert(const T&) -> void*' returning
+ *       a new reference
+ */
+template<typename T, typename Enable = void>
+struct ToPython;
+
+/**
+ * @brief compile-time converter from Python object into C++ value
+ * @note specialize with 'static auto Convert(void*) -> T' reading a borrowed
+ *       reference and throwing std::bad_cast on mismatch
+ */
+template<typename T, typename Enable = void>
+struct FromPython;
+
+template<typename Signature>
+class TypedFunc;
 
 /**
  * @brief PyObject wrapper object
@@ -39,10 +76,14 @@ public:
    * @brief copy constructor
    */
   Object(const Object& obj);
+  /**
+   * @brief move constructor
+   */
+  Object(Object&& obj) noexcept;
   /**
    * @brief destructor
    */
-  virtual ~Object();
+  ~Object();
   /**
    * @brief create new empty object
    * @return Object empty object
@@ -52,6 +93,10 @@ public:
    * @brief operator overload
    */
   auto operator=(const Object& obj) -> Object&;
+  /**
+   * @brief operator overload
+   */
+  auto operator=(Object&& obj) noexcept -> Object&;
   /**
    * @brief operator overload
    */
@@ -107,12 +152,24 @@ public:
    * @return bool judgement result
    */
   auto ContainsAttribute(const std::string& name) const -> bool;
+  /**
+   * @brief judge if current instance contains specified attribute
+   * @param[in] name interned attribute name
+   * @return bool judgement result
+   */
+  auto ContainsAttribute(const Name& name) const -> bool;
   /**
    * @brief remove specified attribute from current instance
    * @param[in] name attribute name
    * @return bool status of removing process
    */
   auto RemoveAttribute(const std::string& name) const -> bool;
+  /**
+   * @brief remove specified attribute from current instance
+   * @param[in] name interned attribute name
+   * @return bool status of removing process
+   */
+  auto RemoveAttribute(const Name& name) const -> bool;
   /**
    * @brief set specified attribute to current instance
    * @param[in] name attribute name
@@ -120,6 +177,13 @@ public:
    * @return bool status of setting process
    */
   auto SetAttribute(const std::string& name, const Object& obj) const -> bool;
+  /**
+   * @brief set specified attribute to current instance
+   * @param[in] name interned attribute name
+   * @param[in] obj input attribute object
+   * @return bool status of setting process
+   */
+  auto SetAttribute(const Name& name, const Object& obj) const -> bool;
   /**
    * @brief set specified attributes to current instance
    * @param[in] dict input Dict attribute
@@ -130,18 +194,63 @@ public:
    * @brief get specified attribute from current instance
    * @param[in] name attribute name
    * @return Generic acquired object
+   * @exception std::logic_error when nonexistent attribute is specified
    */
   auto GetAttribute(const std::string& name) const -> Generic;
+  /**
+   * @brief get specified attribute from current instance
+   * @param[in] name interned attribute name
+   * @return Generic acquired object
+   * @exception std::logic_error when nonexistent attribute is specified
+   */
+  auto GetAttribute(const Name& name) const -> Generic;
   /**
    * @brief get specified attributes from current instance
    * @return Dict acquired objects
    */
   auto GetAttributes() const -> Dict;
+  /**
+   * @brief call specified method of current instance
+   * @param[in] name method name
+   * @param[in] args argument objects
+   * @return Generic the result value of method
+   * @exception std::runtime_error failed to run method
+   * @note no bound method object is created
+   */
+  template<typename... Args>
+  auto CallMethod(const std::string& name, const Args&... args) const -> Generic;
+  /**
+   * @brief call specified method of current instance
+   * @param[in] name interned method name
+   * @param[in] args argument objects
+   * @return Generic the result value of method
+   * @exception std::runtime_error failed to run method
+   * @note no bound method object is created
+   */
+  template<typename... Args>
+  auto CallMethod(const Name& name, const Args&... args) const -> Generic;
 protected:
-  explicit Object(void* ptr);
+  /**
+   * @brief tag to take over a new reference without adding one
+   */
+  struct StealTag {};
+  /**
+   * @brief tag to add a reference to a borrowed one
+   */
+  struct BorrowTag {};
+  Object(void* ptr, StealTag);
+  Object(void* ptr, BorrowTag);
+  auto Release() -> void*;
 private:
-  const class ObjectImpl* pimpl_;
-  int* ref_;
+  void* ptr_;
+  auto CallMethodVector(
+    const std::string& name,
+    void** args,
+    const size_t& size) const -> Generic;
+  auto CallMethodVector(
+    void* name,
+    void** args,
+    const size_t& size) const -> Generic;
   static auto Load(const std::string& file_name) -> Object;
   friend auto Import(const std::string& name) -> Object;
 };
@@ -191,39 +300,83 @@ public:
    * @return Value converted result
    * @exception std::bad_cast failed to interpret
    */
-  auto ToValue() const -> Value;
+  auto ToValue() const& -> Value;
+  /**
+   * @brief convert into Value object taking over the reference
+   * @return Value converted result
+   * @exception std::bad_cast failed to interpret
+   */
+  auto ToValue() && -> Value;
   /**
    * @brief convert into Tuple object
    * @return Tuple converted result
    * @exception std::bad_cast failed to interpret
    */
-  auto ToTuple() const -> Tuple;
+  auto ToTuple() const& -> Tuple;
+  /**
+   * @brief convert into Tuple object taking over the reference
+   * @return Tuple converted result
+   * @exception std::bad_cast failed to interpret
+   */
+  auto ToTuple() && -> Tuple;
   /**
    * @brief convert into List object
    * @return List converted result
    * @exception std::bad_cast failed to interpret
    */
-  auto ToList() const -> List;
+  auto ToList() const& -> List;
+  /**
+   * @brief convert into List object taking over the reference
+   * @return List converted result
+   * @exception std::bad_cast failed to interpret
+   */
+  auto ToList() && -> List;
   /**
    * @brief convert into Dict object
    * @return Dict converted result
    * @exception std::bad_cast failed to interpret
    */
-  auto ToDict() const -> Dict;
+  auto ToDict() const& -> Dict;
+  /**
+   * @brief convert into Dict object taking over the reference
+   * @return Dict converted result
+   * @exception std::bad_cast failed to interpret
+   */
+  auto ToDict() && -> Dict;
   /**
    * @brief convert into Buffer object
    * @return Buffer converted result
    * @exception std::bad_cast failed to interpret
    */
-  auto ToBuffer() const -> Buffer;
+  auto ToBuffer() const& -> Buffer;
+  /**
+   * @brief convert into Buffer object taking over the reference
+   * @return Buffer converted result
+   * @exception std::bad_cast failed to interpret
+   */
+  auto ToBuffer() && -> Buffer;
   /**
    * @brief convert into Func object
    * @return Func converted result
    * @exception std::bad_cast failed to interpret
    */
-  auto ToFunc() const -> Func;
+  auto ToFunc() const& -> Func;
+  /**
+   * @brief convert into Func object taking over the reference
+   * @return Func converted result
+   * @exception std::bad_cast failed to interpret
+   */
+  auto ToFunc() && -> Func;
+  /**
+   * @brief convert all elements of a tuple or list into std::tuple at once
+   * @return std::tuple<Ts...> converted elements (usable with structured bindings)
+   * @exception std::bad_cast size mismatch or failed to interpret an element
+   */
+  template<typename... Ts>
+  auto Unpack() const -> std::tuple<Ts...>;
 protected:
-  explicit Generic(void* ptr);
+  Generic(void* ptr, StealTag tag) : Object(ptr, tag) {}
+  Generic(void* ptr, BorrowTag tag) : Object(ptr, tag) {}
 private:
   friend class Object;
   friend class Value;
@@ -232,6 +385,282 @@ private:
   friend class Dict;
   friend class Buffer;
   friend class Func;
+  friend class CallSite;
+  friend class AttributeCache;
+  friend class ObjectView;
+  template<typename T, typename Enable>
+  friend struct FromPython;
+};
+
+/**
+ * @brief interned and pre-hashed Python string
+ * @note create once and reuse it as attribute name, method name or Dict key
+ */
+class Name final : public Object {
+public:
+  /**
+   * @brief constructor
+   * @param[in] name string value
+   */
+  explicit Name(const std::string& name);
+private:
+  static auto Init(const std::string& name) -> void*;
+};
+
+template<typename... Args>
+inline auto Object::CallMethod(
+  const std::string& name,
+  const Args&... args) const -> Generic {
+  // leading slot is reserved for the callee (vectorcall offset), next holds self
+  void* argv[] = { nullptr, GetRef(), args.GetRef()... };
+  return CallMethodVector(name, argv, 1 + sizeof...(Args));
+}
+
+template<typename... Args>
+inline auto Object::CallMethod(
+  const Name& name,
+  const Args&... args) const -> Generic {
+  // leading slot is reserved for the callee (vectorcall offset), next holds self
+  void* argv[] = { nullptr, GetRef(), args.GetRef()... };
+  return CallMethodVector(name.GetRef(), argv, 1 + sizeof...(Args));
+}
+
+/**
+ * @brief non-owning view of a PyObject handed out by container iterators
+ * @note valid only while the container holds the element and is not modified
+ */
+class ObjectView {
+public:
+  /**
+   * @brief default constructor
+   */
+  ObjectView() : ptr_(nullptr) {}
+  /**
+   * @brief get internal pointer address of the viewed object
+   * @return void* pointer of PyObject
+   */
+  auto GetRef() const -> void* {
+    return ptr_;
+  }
+  /**
+   * @brief get type name of the viewed object
+   * @return std::string type name
+   */
+  auto Type() const -> std::string;
+  /**
+   * @brief take a new reference to the viewed object
+   * @return Generic owning object
+   */
+  auto ToGeneric() const -> Generic;
+private:
+  explicit ObjectView(void* ptr) : ptr_(ptr) {}
+  void* ptr_;
+  friend class Tuple;
+  friend class List;
+  friend class Dict;
+  friend class SequenceIterator;
+};
+
+/**
+ * @brief random access iterator over elements of a List or Tuple
+ * @note invalidated like std::vector iterators when a List is resized
+ */
+class SequenceIterator {
+public:
+  using iterator_category = std::random_access_iterator_tag;
+  using value_type = ObjectView;
+  using difference_type = std::ptrdiff_t;
+  using pointer = void;
+  using reference = ObjectView;
+  /**
+   * @brief default constructor
+   */
+  SequenceIterator() : items_(nullptr) {}
+  /**
+   * @brief operator overload
+   */
+  auto operator*() const -> ObjectView {
+    return ObjectView(*items_);
+  }
+  /**
+   * @brief operator overload
+   */
+  auto operator[](const difference_type& n) const -> ObjectView {
+    return ObjectView(items_[n]);
+  }
+  /**
+   * @brief operator overload
+   */
+  auto operator++() -> SequenceIterator& {
+    ++items_;
+    return *this;
+  }
+  /**
+   * @brief operator overload
+   */
+  auto operator++(int) -> SequenceIterator {
+    return SequenceIterator(items_++);
+  }
+  /**
+   * @brief operator overload
+   */
+  auto operator--() -> SequenceIterator& {
+    --items_;
+    return *this;
+  }
+  /**
+   * @brief operator overload
+   */
+  auto operator--(int) -> SequenceIterator {
+    return SequenceIterator(items_--);
+  }
+  /**
+   * @brief operator overload
+   */
+  auto operator+=(const difference_type& n) -> SequenceIterator& {
+    items_ += n;
+    return *this;
+  }
+  /**
+   * @brief operator overload
+   */
+  auto operator-=(const difference_type& n) -> SequenceIterator& {
+    items_ -= n;
+    return *this;
+  }
+  /**
+   * @brief operator overload
+   */
+  auto operator+(const difference_type& n) const -> SequenceIterator {
+    return SequenceIterator(items_ + n);
+  }
+  /**
+   * @brief operator overload
+   */
+  auto operator-(const difference_type& n) const -> SequenceIterator {
+    return SequenceIterator(items_ - n);
+  }
+  /**
+   * @brief operator overload
+   */
+  auto operator-(const SequenceIterator& it) const -> difference_type {
+    return items_ - it.items_;
+  }
+  /**
+   * @brief operator overload
+   */
+  auto operator==(const SequenceIterator& it) const -> bool {
+    return items_ == it.items_;
+  }
+  /**
+   * @brief operator overload
+   */
+  auto operator!=(const SequenceIterator& it) const -> bool {
+    return items_ != it.items_;
+  }
+  /**
+   * @brief operator overload
+   */
+  auto operator<(const SequenceIterator& it) const -> bool {
+    return items_ < it.items_;
+  }
+  /**
+   * @brief operator overload
+   */
+  auto operator<=(const SequenceIterator& it) const -> bool {
+    return items_ <= it.items_;
+  }
+  /**
+   * @brief operator overload
+   */
+  auto operator>(const SequenceIterator& it) const -> bool {
+    return items_ > it.items_;
+  }
+  /**
+   * @brief operator overload
+   */
+  auto operator>=(const SequenceIterator& it) const -> bool {
+    return items_ >= it.items_;
+  }
+  /**
+   * @brief operator overload
+   */
+  friend auto operator+(
+    const difference_type& n,
+    const SequenceIterator& it) -> SequenceIterator {
+    return it + n;
+  }
+private:
+  explicit SequenceIterator(void* const* items) : items_(items) {}
+  void* const* items_;
+  friend class Tuple;
+  friend class List;
+};
+
+/**
+ * @brief non-owning view of a contiguous array
+ * @note valid only while the object providing the memory is alive
+ */
+template<typename T>
+class Span {
+public:
+  using element_type = T;
+  using value_type = typename std::remove_cv<T>::type;
+  using iterator = T*;
+  /**
+   * @brief default constructor
+   */
+  Span() : data_(nullptr), size_(0) {}
+  /**
+   * @brief constructor
+   * @param[in] data pointer to the first element
+   * @param[in] size count of elements
+   */
+  Span(T* data, const size_t& size) : data_(data), size_(size) {}
+  /**
+   * @brief get pointer to the first element
+   * @return T* pointer
+   */
+  auto data() const -> T* {
+    return data_;
+  }
+  /**
+   * @brief get count of elements
+   * @return size_t count of elements
+   */
+  auto size() const -> size_t {
+    return size_;
+  }
+  /**
+   * @brief judge if the span has no element
+   * @return bool judgement result
+   */
+  auto empty() const -> bool {
+    return size_ == 0;
+  }
+  /**
+   * @brief operator overload
+   */
+  auto operator[](const size_t& index) const -> T& {
+    return data_[index];
+  }
+  /**
+   * @brief get iterator to the first element
+   * @return iterator pointer to the first element
+   */
+  auto begin() const -> iterator {
+    return data_;
+  }
+  /**
+   * @brief get iterator past the last element
+   * @return iterator pointer past the last element
+   */
+  auto end() const -> iterator {
+    return data_ + size_;
+  }
+private:
+  T* data_;
+  size_t size_;
 };
 
 /**
@@ -269,10 +698,19 @@ public:
   static auto FromFloat(const double& value) -> Value;
   /**
    * @brief create new string Value
-   * @param[in] value string value
+   * @param[in] value string value (utf-8, may contain null characters)
    * @return Value string value object
+   * @exception std::bad_cast failed to decode
    */
   static auto FromString(const std::string& value) -> Value;
+  /**
+   * @brief create new string Value
+   * @param[in] value pointer to string value (utf-8)
+   * @param[in] size byte length of input value
+   * @return Value string value object
+   * @exception std::bad_cast failed to decode
+   */
+  static auto FromString(const char* value, const size_t& size) -> Value;
   /**
    * @brief create new bytes Value
    * @param[in] value bytes value
@@ -375,8 +813,27 @@ public:
    * @exception std::bad_cast failed to interpret
    */
   auto ToByteArray() const -> std::vector<char>;
+  /**
+   * @brief view string object contents without copying
+   * @return std::string_view utf-8 contents valid while current instance lives
+   * @exception std::bad_cast failed to interpret
+   */
+  auto ToStringView() const -> std::string_view;
+  /**
+   * @brief view bytes object contents without copying
+   * @return Span<const char> contents valid while current instance lives
+   * @exception std::bad_cast failed to interpret
+   */
+  auto ToBytesView() const -> Span<const char>;
+  /**
+   * @brief view bytearray object contents without copying
+   * @return Span<char> writable contents valid until the bytearray is resized
+   * @exception std::bad_cast failed to interpret
+   */
+  auto ToByteArrayView() const -> Span<char>;
 private:
-  explicit Value(void* ptr);
+  Value(void* ptr, StealTag tag) : Object(ptr, tag) {}
+  Value(void* ptr, BorrowTag tag) : Object(ptr, tag) {}
   friend class Generic;
   friend class Tuple;
   friend class List;
@@ -417,9 +874,43 @@ public:
    * @return std::vector<Generic> converted object
    */
   auto ToStdVector() const -> std::vector<Generic>;
+  /**
+   * @brief convert all elements into std::vector
+   * @return std::vector<T> converted elements
+   * @exception std::bad_cast some element can not be interpreted as T
+   * @note T is any type supported by FromPython; elements of scalar types
+   *       are checked once for the whole sequence
+   */
+  template<typename T>
+  auto ToVector() const -> std::vector<T>;
+  /**
+   * @brief convert all elements into std::tuple at once
+   * @return std::tuple<Ts...> converted elements (usable with structured bindings)
+   * @exception std::bad_cast size mismatch or failed to interpret an element
+   */
+  template<typename... Ts>
+  auto Unpack() const -> std::tuple<Ts...>;
+  /**
+   * @brief get one element without bounds check
+   * @param[in] index index number (asserted in debug builds)
+   * @return ObjectView borrowed element
+   */
+  auto operator[](const size_t& index) const -> ObjectView;
+  using Iterator = SequenceIterator;
+  /**
+   * @brief get iterator to the first element
+   * @return Iterator iterator yielding borrowed views
+   */
+  auto begin() const -> Iterator;
+  /**
+   * @brief get iterator past the last element
+   * @return Iterator end iterator
+   */
+  auto end() const -> Iterator;
 private:
   static auto Init(const std::vector<Object>& initializer) -> void*;
-  explicit Tuple(void* ptr);
+  Tuple(void* ptr, StealTag tag) : Object(ptr, tag) {}
+  Tuple(void* ptr, BorrowTag tag) : Object(ptr, tag) {}
   friend class Generic;
   friend class List;
   friend class Dict;
@@ -436,6 +927,15 @@ public:
    * @param[in] initializer list elements
    */
   explicit List(const std::vector<Object>& initializer = std::vector<Object>());
+  /**
+   * @brief create new List from std::vector
+   * @param[in] values source elements
+   * @return List created object
+   * @exception std::bad_cast some element can not be converted
+   * @note T is any type supported by ToPython
+   */
+  template<typename T>
+  static auto From(const std::vector<T>& values) -> List;
   /**
    * @brief constructor
    * @param[in] head first element of input array
@@ -490,9 +990,44 @@ public:
    * @return std::vector<Generic> converted object
    */
   auto ToStdVector() const -> std::vector<Generic>;
+  /**
+   * @brief convert all elements into std::vector
+   * @return std::vector<T> converted elements
+   * @exception std::bad_cast some element can not be interpreted as T
+   * @note T is any type supported by FromPython; elements of scalar types
+   *       are checked once for the whole sequence
+   */
+  template<typename T>
+  auto ToVector() const -> std::vector<T>;
+  /**
+   * @brief convert all elements into std::tuple at once
+   * @return std::tuple<Ts...> converted elements (usable with structured bindings)
+   * @exception std::bad_cast size mismatch or failed to interpret an element
+   */
+  template<typename... Ts>
+  auto Unpack() const -> std::tuple<Ts...>;
+  /**
+   * @brief get one element without bounds check
+   * @param[in] index index number (asserted in debug builds)
+   * @return ObjectView borrowed element
+   */
+  auto operator[](const size_t& index) const -> ObjectView;
+  using Iterator = SequenceIterator;
+  /**
+   * @brief get iterator to the first element
+   * @return Iterator iterator yielding borrowed views
+   * @note invalidated by Insert, Append or any other resize
+   */
+  auto begin() const -> Iterator;
+  /**
+   * @brief get iterator past the last element
+   * @return Iterator end iterator
+   */
+  auto end() const -> Iterator;
 private:
   static auto Init(const std::vector<Object>& initializer) -> void*;
-  explicit List(void* ptr);
+  List(void* ptr, StealTag tag) : Object(ptr, tag) {}
+  List(void* ptr, BorrowTag tag) : Object(ptr, tag) {}
   friend class Generic;
   friend class Dict;
 };
@@ -544,6 +1079,34 @@ public:
    * @exception std::logic_error when nonexistent key is specified
    */
   auto Get(const Object& key) const -> Generic;
+  /**
+   * @brief get one element
+   * @param[in] key pointer to key characters (utf-8)
+   * @param[in] length byte length of key
+   * @return Generic acquired object
+   * @exception std::logic_error when nonexistent key is specified
+   */
+  auto Get(const char* key, const size_t& length) const -> Generic;
+  /**
+   * @brief get one element without throwing on missing key
+   * @param[in] key key
+   * @return std::optional<Generic> acquired object or std::nullopt
+   */
+  auto TryGet(const std::string& key) const -> std::optional<Generic>;
+  /**
+   * @brief get one element without throwing on missing key
+   * @param[in] key key
+   * @return std::optional<Generic> acquired object or std::nullopt
+   */
+  auto TryGet(const Object& key) const -> std::optional<Generic>;
+  /**
+   * @brief get one element without throwing on missing key
+   * @param[in] key pointer to key characters (utf-8)
+   * @param[in] length byte length of key
+   * @return std::optional<Generic> acquired object or std::nullopt
+   */
+  auto TryGet(const char* key, const size_t& length) const
+    -> std::optional<Generic>;
   /**
    * @brief delete one element
    * @param[in] key key
@@ -556,6 +1119,13 @@ public:
    * @exception std::logic_error when nonexistent key is specified
    */
   auto Delete(const Object& key) const -> void;
+  /**
+   * @brief delete one element
+   * @param[in] key pointer to key characters (utf-8)
+   * @param[in] length byte length of key
+   * @exception std::logic_error when nonexistent key is specified
+   */
+  auto Delete(const char* key, const size_t& length) const -> void;
   /**
    * @brief judge if current instance contains the specified key
    * @param[in] key key
@@ -568,6 +1138,13 @@ public:
    * @return bool judgement result
    */
   auto Contains(const Object& key) const -> bool;
+  /**
+   * @brief judge if current instance contains the specified key
+   * @param[in] key pointer to key characters (utf-8)
+   * @param[in] length byte length of key
+   * @return bool judgement result
+   */
+  auto Contains(const char* key, const size_t& length) const -> bool;
   /**
    * @brief get key objects from current instance
    * @return List key objects
@@ -588,12 +1165,84 @@ public:
    * @return std::vector<std::pair<Generic, Generic>> converted object
    */
   auto ToStdVector() const -> std::vector<std::pair<Generic, Generic>>;
+  /**
+   * @brief forward iterator over key/value pairs of a Dict
+   * @note the Dict must not be resized while iterating
+   */
+  class Iterator {
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = std::pair<ObjectView, ObjectView>;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const value_type*;
+    using reference = const value_type&;
+    /**
+     * @brief default constructor (end iterator)
+     */
+    Iterator() : dict_(nullptr), pos_(0) {}
+    /**
+     * @brief operator overload
+     */
+    auto operator*() const -> reference {
+      return item_;
+    }
+    /**
+     * @brief operator overload
+     */
+    auto operator->() const -> pointer {
+      return &item_;
+    }
+    /**
+     * @brief operator overload
+     */
+    auto operator++() -> Iterator&;
+    /**
+     * @brief operator overload
+     */
+    auto operator++(int) -> Iterator {
+      auto it = *this;
+      ++(*this);
+      return it;
+    }
+    /**
+     * @brief operator overload
+     */
+    auto operator==(const Iterator& it) const -> bool {
+      return dict_ == it.dict_ && pos_ == it.pos_;
+    }
+    /**
+     * @brief operator overload
+     */
+    auto operator!=(const Iterator& it) const -> bool {
+      return !(*this == it);
+    }
+  private:
+    explicit Iterator(void* dict);
+    void* dict_;
+    std::ptrdiff_t pos_;
+    value_type item_;
+    friend class Dict;
+  };
+  /**
+   * @brief get iterator to the first key/value pair
+   * @return Iterator iterator yielding borrowed views
+   */
+  auto begin() const -> Iterator;
+  /**
+   * @brief get iterator past the last key/value pair
+   * @return Iterator end iterator
+   */
+  auto end() const -> Iterator;
 private:
   static auto Init(
     const std::unordered_map<std::string, Object>& initializer) -> void*;
   static auto Init(
     const std::unordered_map<Object, Object>& initializer) -> void*;
-  explicit Dict(void* ptr);
+  static auto Key(const char* key, const size_t& length) -> Value;
+  auto Find(void* key) const -> void*;
+  auto Erase(void* key) const -> void;
+  Dict(void* ptr, StealTag tag) : Object(ptr, tag) {}
+  Dict(void* ptr, BorrowTag tag) : Object(ptr, tag) {}
   friend class Object;
   friend class Generic;
 };
@@ -607,6 +1256,10 @@ public:
    * @brief copy constructor
    */
   Buffer(const Buffer& obj);
+  /**
+   * @brief move constructor
+   */
+  Buffer(Buffer&& obj) noexcept;
   /**
    * @brief destructor
    */
@@ -615,6 +1268,10 @@ public:
    * @brief operator overload
    */
   auto operator=(const Buffer& obj) -> Buffer&;
+  /**
+   * @brief operator overload
+   */
+  auto operator=(Buffer&& obj) noexcept -> Buffer&;
   /**
    * @brief get raw data pointer from buffer
    * @return void* raw data pointer
@@ -660,11 +1317,407 @@ public:
    * @note the vector length should equal to Dimensions()
    */
   auto Strides() const -> std::vector<size_t>;
+  /**
+   * @brief get element count of one dimension (no allocation)
+   * @param[in] axis dimension index
+   * @return size_t element count
+   * @exception std::out_of_range when axis exceeds Dimensions()
+   */
+  auto Shape(const int& axis) const -> size_t;
+  /**
+   * @brief get byte count to the next iteration of one dimension (no allocation)
+   * @param[in] axis dimension index
+   * @return std::ptrdiff_t stride (bytes, negative for reversed views)
+   * @exception std::out_of_range when axis exceeds Dimensions()
+   */
+  auto Strides(const int& axis) const -> std::ptrdiff_t;
+  /**
+   * @brief judge if Python forbids writing into the buffer
+   * @return bool judgement result
+   */
+  auto ReadOnly() const -> bool;
+  /**
+   * @brief export C++ memory to Python through the buffer protocol (no copy)
+   * @param[in] data pointer to the first element
+   * @param[in] itemsize byte count per one element
+   * @param[in] format struct module style format (e.g. "d")
+   * @param[in] shape element count for each dimension
+   * @param[in] strides byte count to the next element for each dimension
+   *   (C-contiguous when empty)
+   * @param[in] deleter called once Python releases the last reference
+   * @param[in] readonly reject writable requests from Python
+   * @return Buffer object usable as memoryview or numpy.asarray argument
+   * @exception std::logic_error when shape and strides mismatch
+   */
+  static auto FromMemory(
+    void* data,
+    const size_t& itemsize,
+    const std::string& format,
+    const std::vector<size_t>& shape,
+    const std::vector<std::ptrdiff_t>& strides = std::vector<std::ptrdiff_t>(),
+    const std::function<void()>& deleter = nullptr,
+    const bool& readonly = false) -> Buffer;
+  /**
+   * @brief export typed C++ memory to Python through the buffer protocol
+   * @param[in] data pointer to the first element (read-only if T is const)
+   * @param[in] shape element count for each dimension
+   * @param[in] strides byte count to the next element for each dimension
+   *   (C-contiguous when empty)
+   * @param[in] deleter called once Python releases the last reference
+   * @return Buffer object usable as memoryview or numpy.asarray argument
+   * @exception std::logic_error when shape and strides mismatch
+   */
+  template<typename T>
+  static auto FromMemory(
+    T* data,
+    const std::vector<size_t>& shape,
+    const std::vector<std::ptrdiff_t>& strides = std::vector<std::ptrdiff_t>(),
+    const std::function<void()>& deleter = nullptr) -> Buffer {
+    using Element = typename std::remove_const<T>::type;
+    return FromMemory(
+      const_cast<Element*>(data), sizeof(T), FormatOf<Element>(),
+      shape, strides, deleter, std::is_const<T>::value);
+  }
+  /**
+   * @brief move std::vector into a buffer owned by Python
+   * @param[in] values elements to take over
+   * @param[in] shape element count for each dimension (1-D when empty)
+   * @return Buffer object usable as memoryview or numpy.asarray argument
+   * @exception std::logic_error when shape does not match the element count
+   */
+  template<typename T>
+  static auto FromVector(
+    std::vector<T>&& values,
+    const std::vector<size_t>& shape = std::vector<size_t>()) -> Buffer {
+    size_t count = 1;
+    for (const auto& extent : shape) {
+      if (extent && count > std::numeric_limits<size_t>::max() / extent) {
+        throw std::logic_error("shape and size mismatch");
+      }
+      count *= extent;
+    }
+    if (!shape.empty() && count != values.size()) {
+      throw std::logic_error("shape and size mismatch");
+    }
+    auto owner = std::make_shared<std::vector<T>>(std::move(values));
+    auto data = owner->data();
+    auto size = owner->size();
+    return FromMemory(
+      data, shape.empty() ? std::vector<size_t>{ size } : shape,
+      std::vector<std::ptrdiff_t>(), [owner]() mutable { owner.reset(); });
+  }
 private:
-  explicit Buffer(void* ptr);
-  class BufferImpl* pimpl_;
-  int* ref_;
+  Buffer(void* ptr, StealTag tag);
+  Buffer(void* ptr, BorrowTag tag);
+  template<typename T>
+  static constexpr auto FormatOf() -> const char* {
+    static_assert(std::is_arithmetic<T>::value, "element must be arithmetic");
+    if (std::is_same<T, bool>::value) {
+      return "?";
+    } else if (std::is_floating_point<T>::value) {
+      return sizeof(T) == 4 ? "f" : sizeof(T) == 8 ? "d" : "g";
+    } else if (std::is_signed<T>::value) {
+      return sizeof(T) == 1 ? "b" : sizeof(T) == 2 ? "h" : sizeof(T) == 4 ? "i" : "q";
+    } else {
+      return sizeof(T) == 1 ? "B" : sizeof(T) == 2 ? "H" : sizeof(T) == 4 ? "I" : "Q";
+    }
+  }
+  template<typename T>
+  static constexpr auto KindOf() -> char {
+    static_assert(std::is_arithmetic<T>::value, "element must be arithmetic");
+    if (std::is_same<T, bool>::value) {
+      return '?';
+    } else if (std::is_floating_point<T>::value) {
+      return 'f';
+    } else if (std::is_signed<T>::value) {
+      return 'i';
+    } else {
+      return 'u';
+    }
+  }
+  auto IsFormat(const char& kind, const size_t& itemsize) const -> bool;
+  void* view_;
   friend class Generic;
+  template<typename T, size_t N>
+  friend class BufferView;
+};
+
+/**
+ * @brief typed N-dimensional view of Buffer memory
+ * @note format and dimensions are validated once at construction;
+ *       valid only while the viewed Buffer lives
+ */
+template<typename T, size_t N>
+class BufferView {
+  static_assert(N > 0, "dimension must be positive");
+  using Byte = typename std::conditional<std::is_const<T>::value, const char, char>::type;
+public:
+  using element_type = T;
+  using value_type = typename std::remove_cv<T>::type;
+  using Slice = typename std::conditional<N == 1, T&, BufferView<T, N - 1>>::type;
+  /**
+   * @brief forward iterator visiting elements in row-major order
+   */
+  class Iterator {
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = typename std::remove_cv<T>::type;
+    using difference_type = std::ptrdiff_t;
+    using pointer = T*;
+    using reference = T&;
+    /**
+     * @brief default constructor
+     */
+    Iterator() : view_(nullptr), ptr_(nullptr), position_(0), index_() {}
+    /**
+     * @brief operator overload
+     */
+    auto operator*() const -> T& {
+      return *reinterpret_cast<T*>(ptr_);
+    }
+    /**
+     * @brief operator overload
+     */
+    auto operator->() const -> T* {
+      return reinterpret_cast<T*>(ptr_);
+    }
+    /**
+     * @brief operator overload
+     */
+    auto operator++() -> Iterator& {
+      ++position_;
+      for (size_t i = N; i-- > 0;) {
+        ptr_ += view_->strides_[i];
+        if (++index_[i] < view_->shape_[i] || i == 0) {
+          break;
+        }
+        ptr_ -= static_cast<std::ptrdiff_t>(index_[i]) * view_->strides_[i];
+        index_[i] = 0;
+      }
+      return *this;
+    }
+    /**
+     * @brief operator overload
+     */
+    auto operator++(int) -> Iterator {
+      auto out = *this;
+      ++(*this);
+      return out;
+    }
+    /**
+     * @brief operator overload
+     */
+    auto operator==(const Iterator& other) const -> bool {
+      return position_ == other.position_;
+    }
+    /**
+     * @brief operator overload
+     */
+    auto operator!=(const Iterator& other) const -> bool {
+      return position_ != other.position_;
+    }
+  private:
+    Iterator(const BufferView* view, const size_t& position)
+      : view_(view), ptr_(view->data_), position_(position), index_() {}
+    const BufferView* view_;
+    Byte* ptr_;
+    size_t position_;
+    std::array<size_t, N> index_;
+    friend class BufferView;
+  };
+  /**
+   * @brief default constructor
+   */
+  BufferView() : data_(nullptr), shape_(), strides_(), contiguous_(false) {}
+  /**
+   * @brief constructor
+   * @param[in] buffer buffer providing the memory
+   * @exception std::bad_cast when dimensions or format mismatch, or when
+   *   T is not const and the buffer is read-only
+   */
+  explicit BufferView(const Buffer& buffer)
+    : data_(static_cast<Byte*>(buffer.Data())), shape_(), strides_(), contiguous_(false) {
+    if (buffer.Dimensions() != static_cast<int>(N) ||
+        !buffer.IsFormat(Buffer::KindOf<value_type>(), sizeof(T)) ||
+        (!std::is_const<T>::value && buffer.ReadOnly())) {
+      throw std::bad_cast();
+    }
+    for (size_t i = 0; i < N; ++i) {
+      shape_[i] = buffer.Shape(static_cast<int>(i));
+      strides_[i] = buffer.Strides(static_cast<int>(i));
+    }
+    contiguous_ = Contiguous();
+  }
+  /**
+   * @brief get dimension count
+   * @return size_t dimension count
+   */
+  static constexpr auto Dimensions() -> size_t {
+    return N;
+  }
+  /**
+   * @brief get pointer to the first element
+   * @return T* pointer
+   */
+  auto Data() const -> T* {
+    return reinterpret_cast<T*>(data_);
+  }
+  /**
+   * @brief get element count for each dimension
+   * @return const std::array<size_t, N>& element counts
+   */
+  auto Shape() const -> const std::array<size_t, N>& {
+    return shape_;
+  }
+  /**
+   * @brief get element count of one dimension
+   * @param[in] axis dimension index
+   * @return size_t element count
+   */
+  auto Shape(const size_t& axis) const -> size_t {
+    return shape_[axis];
+  }
+  /**
+   * @brief get byte count to the next iteration for each dimension
+   * @return const std::array<std::ptrdiff_t, N>& strides (bytes)
+   */
+  auto Strides() const -> const std::array<std::ptrdiff_t, N>& {
+    return strides_;
+  }
+  /**
+   * @brief get byte count to the next iteration of one dimension
+   * @param[in] axis dimension index
+   * @return std::ptrdiff_t stride (bytes)
+   */
+  auto Strides(const size_t& axis) const -> std::ptrdiff_t {
+    return strides_[axis];
+  }
+  /**
+   * @brief get total element count
+   * @return size_t element count
+   */
+  auto Size() const -> size_t {
+    size_t out = 1;
+    for (const auto& s : shape_) {
+      out *= s;
+    }
+    return out;
+  }
+  /**
+   * @brief judge if elements are packed in C order
+   * @return bool judgement result
+   */
+  auto IsContiguous() const -> bool {
+    return contiguous_;
+  }
+  /**
+   * @brief get all elements as a flat array (fast path for tight loops)
+   * @return Span<T> elements in row-major order
+   * @exception std::logic_error when the view is not contiguous
+   */
+  auto Flat() const -> Span<T> {
+    if (!contiguous_) {
+      throw std::logic_error("not contiguous");
+    }
+    return Span<T>(Data(), Size());
+  }
+  /**
+   * @brief get element
+   * @param[in] indices one index for each dimension
+   * @return T& element
+   * @note indices are not range-checked
+   */
+  template<typename... Indices>
+  auto operator()(const Indices&... indices) const -> T& {
+    static_assert(sizeof...(Indices) == N, "index count must equal dimensions");
+    const std::ptrdiff_t index[] = { static_cast<std::ptrdiff_t>(indices)... };
+    std::ptrdiff_t offset = 0;
+    for (size_t i = 0; i < N; ++i) {
+      offset += index[i] * strides_[i];
+    }
+    return *reinterpret_cast<T*>(data_ + offset);
+  }
+  /**
+   * @brief get row (plane, ...) along the first dimension
+   * @param[in] index index of the first dimension
+   * @return Slice element when N is 1, otherwise BufferView<T, N - 1>
+   * @note index is not range-checked
+   */
+  auto operator[](const size_t& index) const -> Slice {
+    auto data = data_ + static_cast<std::ptrdiff_t>(index) * strides_[0];
+    if constexpr (N == 1) {
+      return *reinterpret_cast<T*>(data);
+    } else {
+      return BufferView<T, N - 1>(data, shape_.data() + 1, strides_.data() + 1);
+    }
+  }
+  /**
+   * @brief get iterator to the first element
+   * @return Iterator iterator
+   */
+  auto begin() const -> Iterator {
+    return Iterator(this, 0);
+  }
+  /**
+   * @brief get iterator past the last element
+   * @return Iterator iterator
+   */
+  auto end() const -> Iterator {
+    return Iterator(this, Size());
+  }
+private:
+  BufferView(Byte* data, const size_t* shape, const std::ptrdiff_t* strides)
+    : data_(data), shape_(), strides_(), contiguous_(false) {
+    for (size_t i = 0; i < N; ++i) {
+      shape_[i] = shape[i];
+      strides_[i] = strides[i];
+    }
+    contiguous_ = Contiguous();
+  }
+  auto Contiguous() const -> bool {
+    auto expected = static_cast<std::ptrdiff_t>(sizeof(T));
+    for (size_t i = N; i-- > 0;) {
+      if (shape_[i] != 1 && strides_[i] != expected) {
+        return false;
+      }
+      expected *= static_cast<std::ptrdiff_t>(shape_[i]);
+    }
+    return true;
+  }
+  Byte* data_;
+  std::array<size_t, N> shape_;
+  std::array<std::ptrdiff_t, N> strides_;
+  bool contiguous_;
+  template<typename U, size_t M>
+  friend class BufferView;
+};
+
+/**
+ * @brief interned keyword names for keyword argument calls
+ * @note create once and reuse it, so that calls allocate no name strings
+ */
+class Keywords final : public Object {
+public:
+  /**
+   * @brief constructor
+   * @param[in] names keyword names
+   */
+  explicit Keywords(const std::vector<std::string>& names);
+  /**
+   * @brief constructor
+   * @param[in] head first keyword name
+   * @param[in] args subsequent keyword names
+   */
+  template<typename... Args>
+  inline Keywords(const std::string& head, const Args&... args)
+    : Keywords(std::vector<std::string>{ head, args... }) {}
+  /**
+   * @brief get count of keyword names
+   * @return size_t count of keyword names
+   */
+  auto Size() const -> size_t;
+private:
+  static auto Init(const std::vector<std::string>& names) -> void*;
 };
 
 /**
@@ -697,8 +1750,10 @@ public:
   auto Invoke(
     const Object& first,
     const Object& second,
-    const Args&... args) -> Generic {
-    return InvokeTuple(Tuple(first, second, args...));
+    const Args&... args) const -> Generic {
+    // leading slot is reserved for the callee (vectorcall offset)
+    void* argv[] = { nullptr, first.GetRef(), second.GetRef(), args.GetRef()... };
+    return InvokeVector(argv, 2 + sizeof...(Args));
   }
   /**
    * @brief invoke function
@@ -725,126 +1780,1355 @@ public:
   auto operator()(
     const Object& first,
     const Object& second,
-    const Args&... args) -> Generic {
-    return InvokeTuple(Tuple(first, second, args...));
+    const Args&... args) const -> Generic {
+    return Invoke(first, second, args...);
+  }
+  /**
+   * @brief invoke function with keyword arguments
+   * @param[in] keywords names of the trailing arguments
+   * @param[in] args positional arguments followed by keyword arguments
+   * @return the result value of function
+   * @exception std::logic_error when arguments are fewer than keywords
+   * @note void function returns 'None' object
+   */
+  template<typename... Args>
+  auto InvokeWithKeywords(
+    const Keywords& keywords,
+    const Args&... args) const -> Generic {
+    // leading slot is reserved for the callee (vectorcall offset)
+    void* argv[] = { nullptr, args.GetRef()... };
+    return InvokeVector(argv, sizeof...(Args), &keywords);
   }
+  /**
+   * @brief invoke function for each input under one GIL acquisition
+   * @param[in] inputs arguments of each call (any type with ToPython, or
+   *   std::tuple of them for multiple arguments)
+   * @param[out] outputs results of each call (any type with FromPython),
+   *   replaced keeping its capacity
+   * @exception std::runtime_error failed to run function
+   * @exception std::bad_cast failed to interpret a result
+   * @note the calling thread must not hold the GIL through GILContext::Lock()
+   */
+  template<typename T, typename R>
+  auto Map(const std::vector<T>& inputs, std::vector<R>& outputs) const -> void;
+  /**
+   * @brief get statically typed view of current function
+   * @return TypedFunc<Signature> typed function (e.g. double(long, std::string))
+   */
+  template<typename Signature>
+  auto Typed() const -> TypedFunc<Signature>;
 private:
-  explicit Func(void* ptr);
-  auto InvokeTuple(const Tuple& args) const -> Generic;
+  Func(void* ptr, StealTag tag) : Object(ptr, tag) {}
+  Func(void* ptr, BorrowTag tag) : Object(ptr, tag) {}
+  auto InvokeVector(
+    void** args,
+    const size_t& size,
+    const Keywords* keywords = nullptr) const -> Generic;
+  auto InvokeRaw(void** args, const size_t& size) const -> void*;
+  auto InvokeBatch(
+    const size_t& count,
+    const size_t& arity,
+    const std::function<void(const size_t&, void**)>& bind,
+    const std::function<void(const size_t&, void*)>& store) const -> void;
   friend class Generic;
+  template<typename Signature>
+  friend class TypedFunc;
 };
 
 /**
- * @brief GIL context management object (scoped locking pettern)
+ * @brief prepared invocation of one function with a fixed argument count
+ * @note argument slots are reused between calls, unbound slots are 'None'
  */
-class GILContext {
+class CallSite {
 public:
   /**
-   * @brief default constructor
-   * @note require locking all Python procedures until this instance released
+   * @brief constructor
+   * @param[in] func function to invoke
+   * @param[in] arity argument count
    */
-  GILContext();
+  CallSite(const Func& func, const size_t& arity);
+  CallSite(const CallSite& obj) = delete;
+  /**
+   * @brief move constructor
+   */
+  CallSite(CallSite&& obj) noexcept;
   /**
    * @brief destructor
-   * @note if not released yet, call Release()
    */
-  virtual ~GILContext();
+  ~CallSite();
+  auto operator=(const CallSite& obj) -> CallSite& = delete;
   /**
-   * @brief release current holding context
-   * @note destructor calls this method
+   * @brief operator overload
    */
-  auto Release() -> void;
+  auto operator=(CallSite&& obj) noexcept -> CallSite&;
   /**
-   * @brief lock Python procedures
+   * @brief get argument count
+   * @return size_t argument count
    */
-  auto Lock() -> void;
+  auto Arity() const -> size_t;
   /**
-   * @brief unlock Python procedures
-   * @warning if unlock the unlocked context, memory corruption will occur
+   * @brief bind an object to one argument slot
+   * @param[in] index slot index
+   * @param[in] arg argument object
+   * @return CallSite& current instance
+   * @exception std::out_of_range when index exceeds the arity
    */
-  auto Unlock() -> void;
+  auto Set(const size_t& index, const Object& arg) -> CallSite&;
   /**
-   * @brief lock and unlock before and after processing (scoped locking pettern)
-   * @param[in] func any void function to be executed in locked context
+   * @brief bind a boolean value to one argument slot
+   * @param[in] index slot index
+   * @param[in] value boolean value
+   * @return CallSite& current instance
+   * @exception std::out_of_range when index exceeds the arity
    */
-  auto Scope(const std::function<void(void)>& func) -> void;
+  auto SetBool(const size_t& index, const bool& value) -> CallSite&;
+  /**
+   * @brief bind an integer value to one argument slot
+   * @param[in] index slot index
+   * @param[in] value integer value
+   * @return CallSite& current instance
+   * @exception std::out_of_range when index exceeds the arity
+   * @exception std::bad_cast when the value can not be converted
+   */
+  auto SetInt(const size_t& index, const long& value) -> CallSite&;
+  /**
+   * @brief bind a float value to one argument slot
+   * @param[in] index slot index
+   * @param[in] value float value
+   * @return CallSite& current instance
+   * @exception std::out_of_range when index exceeds the arity
+   * @exception std::bad_cast when the value can not be converted
+   */
+  auto SetFloat(const size_t& index, const double& value) -> CallSite&;
+  /**
+   * @brief bind a string value to one argument slot
+   * @param[in] index slot index
+   * @param[in] value string value
+   * @return CallSite& current instance
+   * @exception std::out_of_range when index exceeds the arity
+   * @exception std::bad_cast when the value can not be converted
+   */
+  auto SetString(const size_t& index, const std::string& value) -> CallSite&;
+  /**
+   * @brief invoke function with the bound arguments
+   * @return the result value of function
+   * @note void function returns 'None' object
+   */
+  auto Invoke() const -> Generic;
+  /**
+   * @brief invoke function with the bound arguments
+   * @return the result value of function
+   * @note void function returns 'None' object
+   */
+  auto operator()() const -> Generic;
 private:
-  class GILContextImpl* pimpl_;
-  bool released_;
+  auto Slot(const size_t& index) -> void**;
+  class CallSiteImpl* pimpl_;
 };
 
 /**
- * @brief initialize Python interpreter
+ * @brief attribute lookup cache of one object (e.g. module)
+ * @note entries are dropped when any module is reloaded through Reload()
  */
-auto Initialize() -> void;
+class AttributeCache {
+public:
+  /**
+   * @brief constructor
+   * @param[in] obj object to look up attributes from
+   */
+  explicit AttributeCache(const Object& obj);
+  /**
+   * @brief get specified attribute, looking up only on the first call
+   * @param[in] name interned attribute name
+   * @return Generic acquired object
+   * @exception std::logic_error when nonexistent attribute is specified
+   */
+  auto Get(const Name& name) -> Generic;
+  /**
+   * @brief get specified attribute, looking up only on the first call
+   * @param[in] name attribute name
+   * @return Generic acquired object
+   * @exception std::logic_error when nonexistent attribute is specified
+   */
+  auto Get(const std::string& name) -> Generic;
+  /**
+   * @brief drop all cached attributes
+   */
+  auto Clear() -> void;
+private:
+  auto Get(void* name) -> Generic;
+  Object target_;
+  Dict entries_;
+  size_t generation_;
+};
+
+namespace detail {
 
 /**
- * @brief initialize Python interpreter
- * @param[in] executable_path path to Python executable
- * @param[in] modules_search_path path to search modules
+ * @brief create new Python objects (new reference)
+ * @exception std::bad_cast failed to create
  */
-auto Initialize(
-  const std::wstring& executable_path, 
-  const std::wstring& modules_search_path) -> void;
+auto NewNone() -> void*;
+auto NewBool(const bool& value) -> void*;
+auto NewInt(const long long& value) -> void*;
+auto NewUInt(const unsigned long long& value) -> void*;
+auto NewFloat(const double& value) -> void*;
+auto NewString(const char* value, const size_t& size) -> void*;
+auto NewList(const size_t& size) -> void*;
+auto NewTuple(const size_t& size) -> void*;
+auto NewDict() -> void*;
 
 /**
- * @brief finalize Python interpreter
+ * @brief fill containers created above, stealing the item references
+ * @exception std::bad_cast failed to insert (e.g. unhashable key)
  */
-auto Finalize() -> void;
+auto SetListItem(void* list, const size_t& index, void* item) -> void;
+auto SetTupleItem(void* tuple, const size_t& index, void* item) -> void;
+auto SetDictItem(void* dict, void* key, void* value) -> void;
 
 /**
- * @brief register module loading directory
- * @param[in] target_path the directory path to target module
+ * @brief read Python objects (borrowed reference)
+ * @exception std::bad_cast failed to interpret
  */
-auto AddModuleDirectory(const std::string& target_path) -> void;
+auto IsNone(void* obj) -> bool;
+auto AsBool(void* obj) -> bool;
+auto AsInt(void* obj) -> long long;
+auto AsUInt(void* obj) -> unsigned long long;
+auto AsFloat(void* obj) -> double;
+auto AsString(void* obj) -> std::string;
+auto SequenceSize(void* obj) -> size_t;
+auto SequenceItem(void* obj, const size_t& index) -> void*;
+auto SequenceItems(void* obj, size_t& size) -> void* const*;
+auto DictSize(void* obj) -> size_t;
+auto DictNext(void* obj, std::ptrdiff_t& pos, void*& key, void*& value) -> bool;
 
-// short-cut functions
+/**
+ * @brief scalar types whose elements are verified once per sequence
+ */
+enum class ItemType { Bool, Int, Float, String };
 
 /**
- * @brief import Python module
- * @param[in] name module name or script file name (excluding '.py')
- * @return Object acquired module object
+ * @brief judge if all elements are exactly of the type (not subclasses)
  */
-inline auto Import(const std::string& name) -> Object {
-  return Object::Load(name);
-}
+auto IsExactType(void* const* items, const size_t& size, const ItemType& type) -> bool;
 
 /**
- * @brief create new boolean object
- * @param[in] value input boolean value
- * @return Value constructed Python object
+ * @brief read Python objects verified by IsExactType (borrowed reference)
+ * @exception std::bad_cast failed to interpret (e.g. out of range)
  */
-inline auto Bool(const bool& value) -> Value {
-  return poppy::Value::FromBool(value);
-}
+auto AsExactBool(void* obj) -> bool;
+auto AsExactInt(void* obj) -> long long;
+auto AsExactUInt(void* obj) -> unsigned long long;
+auto AsExactFloat(void* obj) -> double;
+auto AsExactString(void* obj) -> std::string;
+
+auto IncRef(void* obj) -> void;
+auto DecRef(void* obj) -> void;
 
 /**
- * @brief create new int object
- * @param[in] value input int value
- * @return Value constructed Python object
+ * @brief owned reference released at the end of scope
  */
-template<typename T>
-inline auto Int(const T& value) -> Value {
-  return poppy::Value::FromInt(value);
-}
+struct Reference {
+  explicit Reference(void* ptr) : ptr(ptr) {}
+  Reference(const Reference&) = delete;
+  auto operator=(const Reference&) -> Reference& = delete;
+  ~Reference() {
+    if (ptr) {
+      DecRef(ptr);
+    }
+  }
+  auto Release() -> void* {
+    auto released = ptr;
+    ptr = nullptr;
+    return released;
+  }
+  void* ptr;
+};
 
 /**
- * @brief create new float object
- * @param[in] value input float value
- * @return Value constructed Python object
+ * @brief vectorcall argument array owning its converted arguments
+ * @note leading slot is reserved for the callee (vectorcall offset)
  */
+template<size_t N>
+struct ArgumentArray {
+  ArgumentArray() : items() {}
+  ArgumentArray(const ArgumentArray&) = delete;
+  auto operator=(const ArgumentArray&) -> ArgumentArray& = delete;
+  ~ArgumentArray() {
+    for (auto item : items) {
+      if (item) {
+        DecRef(item);
+      }
+    }
+  }
+  void* items[N + 1];
+};
+
+template<typename T, typename Iterator>
+inline auto RangeToList(Iterator first, Iterator last, const size_t& size) -> void* {
+  Reference list(NewList(size));
+  for (size_t i = 0; first != last; ++first, ++i) {
+    SetListItem(list.ptr, i, ToPython<T>::Convert(*first));
+  }
+  return list.Release();
+}
+
+template<typename Tuple, size_t... Is>
+inline auto TupleToPython(const Tuple& values, std::index_sequence<Is...>) -> void* {
+  Reference tuple(NewTuple(sizeof...(Is)));
+  (void)tuple;
+  (void)std::initializer_list<int>{ (SetTupleItem(tuple.ptr, Is,
+    ToPython<typename std::tuple_element<Is, Tuple>::type>::Convert(
+      std::get<Is>(values))), 0)... };
+  return tuple.Release();
+}
+
+template<typename Map>
+inline auto MapToPython(const Map& values) -> void* {
+  Reference dict(NewDict());
+  for (const auto& kv : values) {
+    Reference key(ToPython<typename Map::key_type>::Convert(kv.first));
+    Reference value(ToPython<typename Map::mapped_type>::Convert(kv.second));
+    SetDictItem(dict.ptr, key.Release(), value.Release());
+  }
+  return dict.Release();
+}
+
+template<typename T, typename... Ts, size_t... Is>
+inline auto SequenceToTuple(void* obj, std::index_sequence<Is...>) -> T {
+  if (SequenceSize(obj) != sizeof...(Ts)) {
+    throw std::bad_cast();
+  }
+  return T(FromPython<Ts>::Convert(SequenceItem(obj, Is))...);
+}
+
+template<typename T, size_t N, size_t... Is>
+inline auto SequenceToArray(void* obj, std::index_sequence<Is...>) -> std::array<T, N> {
+  if (SequenceSize(obj) != N) {
+    throw std::bad_cast();
+  }
+  return std::array<T, N>{ { FromPython<T>::Convert(SequenceItem(obj, Is))... } };
+}
+
+template<typename T, typename Enable = void>
+struct HasExactType : std::false_type {};
+
 template<typename T>
-inline auto Float(const T& value) -> Value {
-  return poppy::Value::FromFloat(value);
+struct HasExactType<T, std::void_t<decltype(FromPython<T>::exact_type)>> : std::true_type {};
+
+template<typename T, typename Allocator>
+inline auto ItemsToVector(void* const* items, const size_t& size,
+  std::vector<T, Allocator>& values, std::false_type) -> void {
+  for (size_t i = 0; i < size; ++i) {
+    values.push_back(FromPython<T>::Convert(items[i]));
+  }
 }
 
-/**
- * @brief create new string object
- * @param[in] value input string value
- * @return Value constructed Python object
- */
-inline auto Str(const std::string& value) -> Value {
-  return poppy::Value::FromString(value);
+template<typename T, typename Allocator>
+inline auto ItemsToVector(void* const* items, const size_t& size,
+  std::vector<T, Allocator>& values, std::true_type) -> void {
+  // verify the element type once, then convert without per-element checks
+  if (!IsExactType(items, size, FromPython<T>::exact_type)) {
+    ItemsToVector(items, size, values, std::false_type());
+    return;
+  }
+  values.resize(size);
+  for (size_t i = 0; i < size; ++i) {
+    values[i] = FromPython<T>::ConvertExact(items[i]);
+  }
+}
+
+template<typename Map>
+inline auto DictToMap(void* obj) -> Map {
+  Map values;
+  std::ptrdiff_t pos = 0;
+  void* key = nullptr;
+  void* value = nullptr;
+  while (DictNext(obj, pos, key, value)) {
+    values.emplace(
+      FromPython<typename Map::key_type>::Convert(key),
+      FromPython<typename Map::mapped_type>::Convert(value));
+  }
+  return values;
+}
+
+inline auto CastGeneric(Generic&& obj, Object*) -> Object {
+  return std::move(obj);
+}
+
+inline auto CastGeneric(Generic&& obj, Value*) -> Value {
+  return std::move(obj).ToValue();
+}
+
+inline auto CastGeneric(Generic&& obj, Tuple*) -> Tuple {
+  return std::move(obj).ToTuple();
+}
+
+inline auto CastGeneric(Generic&& obj, List*) -> List {
+  return std::move(obj).ToList();
+}
+
+inline auto CastGeneric(Generic&& obj, Dict*) -> Dict {
+  return std::move(obj).ToDict();
+}
+
+inline auto CastGeneric(Generic&& obj, Buffer*) -> Buffer {
+  return std::move(obj).ToBuffer();
+}
+
+inline auto CastGeneric(Generic&& obj, Func*) -> Func {
+  return std::move(obj).ToFunc();
+}
+
+}  // namespace detail
+
+template<>
+struct ToPython<bool> {
+  static auto Convert(const bool& value) -> void* {
+    return detail::NewBool(value);
+  }
+};
+
+template<typename T>
+struct ToPython<T, typename std::enable_if<
+  std::is_integral<T>::value && !std::is_same<T, bool>::value>::type> {
+  static auto Convert(const T& value) -> void* {
+    if (std::is_signed<T>::value) {
+      return detail::NewInt(static_cast<long long>(value));
+    } else {
+      return detail::NewUInt(static_cast<unsigned long long>(value));
+    }
+  }
+};
+
+template<typename T>
+struct ToPython<T, typename std::enable_if<std::is_floating_point<T>::value>::type> {
+  static auto Convert(const T& value) -> void* {
+    return detail::NewFloat(static_cast<double>(value));
+  }
+};
+
+template<>
+struct ToPython<std::string> {
+  static auto Convert(const std::string& value) -> void* {
+    return detail::NewString(value.data(), value.size());
+  }
+};
+
+template<>
+struct ToPython<std::string_view> {
+  static auto Convert(const std::string_view& value) -> void* {
+    return detail::NewString(value.data(), value.size());
+  }
+};
+
+template<>
+struct ToPython<const char*> {
+  static auto Convert(const char* const& value) -> void* {
+    return detail::NewString(value, std::char_traits<char>::length(value));
+  }
+};
+
+template<typename T>
+struct ToPython<T, typename std::enable_if<std::is_base_of<Object, T>::value>::type> {
+  static auto Convert(const T& value) -> void* {
+    detail::IncRef(value.GetRef());
+    return value.GetRef();
+  }
+};
+
+template<typename T>
+struct ToPython<std::optional<T>> {
+  static auto Convert(const std::optional<T>& value) -> void* {
+    return value ? ToPython<T>::Convert(*value) : detail::NewNone();
+  }
+};
+
+template<typename T, typename Allocator>
+struct ToPython<std::vector<T, Allocator>> {
+  static auto Convert(const std::vector<T, Allocator>& values) -> void* {
+    return detail::RangeToList<T>(values.begin(), values.end(), values.size());
+  }
+};
+
+template<typename T, size_t N>
+struct ToPython<std::array<T, N>> {
+  static auto Convert(const std::array<T, N>& values) -> void* {
+    return detail::RangeToList<T>(values.begin(), values.end(), N);
+  }
+};
+
+template<typename T1, typename T2>
+struct ToPython<std::pair<T1, T2>> {
+  static auto Convert(const std::pair<T1, T2>& values) -> void* {
+    return detail::TupleToPython(values, std::index_sequence_for<T1, T2>());
+  }
+};
+
+template<typename... Ts>
+struct ToPython<std::tuple<Ts...>> {
+  static auto Convert(const std::tuple<Ts...>& values) -> void* {
+    return detail::TupleToPython(values, std::index_sequence_for<Ts...>());
+  }
+};
+
+template<typename K, typename V, typename Compare, typename Allocator>
+struct ToPython<std::map<K, V, Compare, Allocator>> {
+  static auto Convert(const std::map<K, V, Compare, Allocator>& values) -> void* {
+    return detail::MapToPython(values);
+  }
+};
+
+template<typename K, typename V, typename Hash, typename Equal, typename Allocator>
+struct ToPython<std::unordered_map<K, V, Hash, Equal, Allocator>> {
+  static auto Convert(
+    const std::unordered_map<K, V, Hash, Equal, Allocator>& values) -> void* {
+    return detail::MapToPython(values);
+  }
+};
+
+template<>
+struct FromPython<bool> {
+  static constexpr auto exact_type = detail::ItemType::Bool;
+  static auto Convert(void* obj) -> bool {
+    return detail::AsBool(obj);
+  }
+  static auto ConvertExact(void* obj) -> bool {
+    return detail::AsExactBool(obj);
+  }
+};
+
+template<typename T>
+struct FromPython<T, typename std::enable_if<
+  std::is_integral<T>::value && !std::is_same<T, bool>::value>::type> {
+  static constexpr auto exact_type = detail::ItemType::Int;
+  static auto Convert(void* obj) -> T {
+    if (std::is_signed<T>::value) {
+      return Narrow(detail::AsInt(obj));
+    } else {
+      return Narrow(detail::AsUInt(obj));
+    }
+  }
+  static auto ConvertExact(void* obj) -> T {
+    if (std::is_signed<T>::value) {
+      return Narrow(detail::AsExactInt(obj));
+    } else {
+      return Narrow(detail::AsExactUInt(obj));
+    }
+  }
+private:
+  static auto Narrow(const long long& value) -> T {
+    if (value < static_cast<long long>(std::numeric_limits<T>::min()) ||
+        value > static_cast<long long>(std::numeric_limits<T>::max())) {
+      throw std::bad_cast();
+    }
+    return static_cast<T>(value);
+  }
+  static auto Narrow(const unsigned long long& value) -> T {
+    if (value > static_cast<unsigned long long>(std::numeric_limits<T>::max())) {
+      throw std::bad_cast();
+    }
+    return static_cast<T>(value);
+  }
+};
+
+template<typename T>
+struct FromPython<T, typename std::enable_if<std::is_floating_point<T>::value>::type> {
+  static constexpr auto exact_type = detail::ItemType::Float;
+  static auto Convert(void* obj) -> T {
+    return static_cast<T>(detail::AsFloat(obj));
+  }
+  static auto ConvertExact(void* obj) -> T {
+    return static_cast<T>(detail::AsExactFloat(obj));
+  }
+};
+
+template<>
+struct FromPython<std::string> {
+  static constexpr auto exact_type = detail::ItemType::String;
+  static auto Convert(void* obj) -> std::string {
+    return detail::AsString(obj);
+  }
+  static auto ConvertExact(void* obj) -> std::string {
+    return detail::AsExactString(obj);
+  }
+};
+
+template<>
+struct FromPython<Generic> {
+  static auto Convert(void* obj) -> Generic {
+    return Generic(obj, Generic::BorrowTag());
+  }
+};
+
+template<typename T>
+struct FromPython<T, typename std::enable_if<
+  std::is_base_of<Object, T>::value && !std::is_same<T, Generic>::value>::type> {
+  static auto Convert(void* obj) -> T {
+    return detail::CastGeneric(
+      FromPython<Generic>::Convert(obj), static_cast<T*>(nullptr));
+  }
+};
+
+template<typename T>
+struct FromPython<std::optional<T>> {
+  static auto Convert(void* obj) -> std::optional<T> {
+    if (detail::IsNone(obj)) {
+      return std::nullopt;
+    }
+    return FromPython<T>::Convert(obj);
+  }
+};
+
+template<typename T, typename Allocator>
+struct FromPython<std::vector<T, Allocator>> {
+  static auto Convert(void* obj) -> std::vector<T, Allocator> {
+    size_t size = 0;
+    auto items = detail::SequenceItems(obj, size);
+    std::vector<T, Allocator> values;
+    values.reserve(size);
+    detail::ItemsToVector(items, size, values, detail::HasExactType<T>());
+    return values;
+  }
+};
+
+template<typename T, size_t N>
+struct FromPython<std::array<T, N>> {
+  static auto Convert(void* obj) -> std::array<T, N> {
+    return detail::SequenceToArray<T, N>(obj, std::make_index_sequence<N>());
+  }
+};
+
+template<typename T1, typename T2>
+struct FromPython<std::pair<T1, T2>> {
+  static auto Convert(void* obj) -> std::pair<T1, T2> {
+    return detail::SequenceToTuple<std::pair<T1, T2>, T1, T2>(
+      obj, std::index_sequence_for<T1, T2>());
+  }
+};
+
+template<typename... Ts>
+struct FromPython<std::tuple<Ts...>> {
+  static auto Convert(void* obj) -> std::tuple<Ts...> {
+    return detail::SequenceToTuple<std::tuple<Ts...>, Ts...>(
+      obj, std::index_sequence_for<Ts...>());
+  }
+};
+
+template<typename K, typename V, typename Compare, typename Allocator>
+struct FromPython<std::map<K, V, Compare, Allocator>> {
+  static auto Convert(void* obj) -> std::map<K, V, Compare, Allocator> {
+    return detail::DictToMap<std::map<K, V, Compare, Allocator>>(obj);
+  }
+};
+
+template<typename K, typename V, typename Hash, typename Equal, typename Allocator>
+struct FromPython<std::unordered_map<K, V, Hash, Equal, Allocator>> {
+  static auto Convert(void* obj) -> std::unordered_map<K, V, Hash, Equal, Allocator> {
+    return detail::DictToMap<std::unordered_map<K, V, Hash, Equal, Allocator>>(obj);
+  }
+};
+
+template<typename... Ts>
+inline auto Generic::Unpack() const -> std::tuple<Ts...> {
+  return FromPython<std::tuple<Ts...>>::Convert(GetRef());
+}
+
+template<typename... Ts>
+inline auto Tuple::Unpack() const -> std::tuple<Ts...> {
+  return FromPython<std::tuple<Ts...>>::Convert(GetRef());
+}
+
+template<typename... Ts>
+inline auto List::Unpack() const -> std::tuple<Ts...> {
+  return FromPython<std::tuple<Ts...>>::Convert(GetRef());
+}
+
+template<typename T>
+inline auto Tuple::ToVector() const -> std::vector<T> {
+  return FromPython<std::vector<T>>::Convert(GetRef());
+}
+
+template<typename T>
+inline auto List::ToVector() const -> std::vector<T> {
+  return FromPython<std::vector<T>>::Convert(GetRef());
+}
+
+template<typename T>
+inline auto List::From(const std::vector<T>& values) -> List {
+  return List(ToPython<std::vector<T>>::Convert(values), StealTag());
+}
+
+namespace detail {
+
+template<typename T>
+struct BatchArity {
+  static constexpr size_t value = 1;
+};
+
+template<typename... Ts>
+struct BatchArity<std::tuple<Ts...>> {
+  static constexpr size_t value = sizeof...(Ts);
+};
+
+template<typename Tuple, size_t... Is>
+inline auto BindArguments(void** slots, const Tuple& values, std::index_sequence<Is...>) -> void {
+  (void)std::initializer_list<int>{ (slots[Is] =
+    ToPython<typename std::tuple_element<Is, Tuple>::type>::Convert(std::get<Is>(values)), 0)... };
+}
+
+template<typename T>
+inline auto BindArguments(void** slots, const T& value) -> void {
+  slots[0] = ToPython<T>::Convert(value);
+}
+
+template<typename... Ts>
+inline auto BindArguments(void** slots, const std::tuple<Ts...>& values) -> void {
+  BindArguments(slots, values, std::index_sequence_for<Ts...>());
+}
+
+}  // namespace detail
+
+template<typename T, typename R>
+inline auto Func::Map(const std::vector<T>& inputs, std::vector<R>& outputs) const -> void {
+  outputs.clear();
+  outputs.reserve(inputs.size());
+  InvokeBatch(
+    inputs.size(),
+    detail::BatchArity<T>::value,
+    [&inputs](const size_t& i, void** slots) {
+      detail::BindArguments(slots, inputs[i]);
+    },
+    [&outputs](const size_t&, void* result) {
+      outputs.push_back(FromPython<R>::Convert(result));
+    });
+}
+
+/**
+ * @brief function object with a signature fixed at compile time
+ * @note arguments and result are converted through ToPython / FromPython
+ *       without intermediate Object instances
+ */
+template<typename R, typename... Args>
+class TypedFunc<R(Args...)> {
+public:
+  /**
+   * @brief constructor
+   * @param[in] func function to invoke
+   */
+  explicit TypedFunc(const Func& func) : func_(func) {}
+  /**
+   * @brief invoke function
+   * @param[in] args arguments
+   * @return R converted result value of function
+   * @exception std::runtime_error failed to run function
+   * @exception std::bad_cast failed to convert an argument or the result
+   */
+  auto operator()(const typename std::decay<Args>::type&... args) const -> R {
+    detail::ArgumentArray<sizeof...(Args)> argv;
+    size_t i = 1;
+    (void)i;
+    (void)std::initializer_list<int>{ (argv.items[i++] =
+      ToPython<typename std::decay<Args>::type>::Convert(args), 0)... };
+    detail::Reference result(func_.InvokeRaw(argv.items, sizeof...(Args)));
+    return Extract(result.ptr, std::is_void<R>());
+  }
+  /**
+   * @brief get untyped function
+   * @return const Func& wrapped function
+   */
+  auto GetFunc() const -> const Func& {
+    return func_;
+  }
+private:
+  static auto Extract(void*, std::true_type) -> void {}
+  template<typename T = R>
+  static auto Extract(void* obj, std::false_type) -> T {
+    return FromPython<typename std::decay<T>::type>::Convert(obj);
+  }
+  Func func_;
+};
+
+template<typename Signature>
+inline auto Func::Typed() const -> TypedFunc<Signature> {
+  return TypedFunc<Signature>(*this);
+}
+
+/**
+ * @brief GIL context management object (scoped locking pettern)
+ */
+class GILContext {
+public:
+  /**
+   * @brief default constructor
+   * @note require locking all Python procedures until this instance released
+   */
+  GILContext();
+  /**
+   * @brief destructor
+   * @note if not released yet, call Release()
+   */
+  virtual ~GILContext();
+  /**
+   * @brief release current holding context
+   * @note destructor calls this method
+   */
+  auto Release() -> void;
+  /**
+   * @brief lock Python procedures
+   * @note lock state is kept per thread, so threads and nested locks
+   *       do not interfere
+   */
+  auto Lock() -> void;
+  /**
+   * @brief unlock Python procedures
+   * @exception std::logic_error when the calling thread holds no lock
+   */
+  auto Unlock() -> void;
+  /**
+   * @brief lock and unlock before and after processing (scoped locking pettern)
+   * @param[in] func any void function to be executed in locked context
+   */
+  auto Scope(const std::function<void(void)>& func) -> void;
+private:
+  class GILContextImpl* pimpl_;
+  bool released_;
+};
+
+/**
+ * @brief scoped GIL acquisition for the calling thread
+ * @note does nothing when the thread already holds the GIL, so it nests
+ *       freely and needs no shared object; usable from any thread
+ */
+class GILAcquire {
+public:
+  /**
+   * @brief constructor (acquire the GIL unless already held)
+   */
+  GILAcquire();
+  /**
+   * @brief destructor (release the GIL if this instance acquired it)
+   */
+  ~GILAcquire();
+  GILAcquire(const GILAcquire&) = delete;
+  auto operator=(const GILAcquire&) -> GILAcquire& = delete;
+private:
+  int state_;
+};
+
+/**
+ * @brief persistent Python thread state of the calling thread
+ * @note create at the start of a worker thread and destroy it on the same
+ *       thread before the thread exits (and before Finalize()). while it
+ *       lives, GILAcquire and GILContext::Lock swap the prepared thread state
+ *       in and out instead of creating one per acquisition, and Python
+ *       thread-local data persists.
+ *       nested registrations on one thread are no-ops
+ */
+class ThreadRegistration {
+public:
+  /**
+   * @brief constructor (create thread state, the GIL is not required)
+   */
+  ThreadRegistration();
+  /**
+   * @brief destructor (delete thread state)
+   */
+  ~ThreadRegistration();
+  ThreadRegistration(const ThreadRegistration&) = delete;
+  auto operator=(const ThreadRegistration&) -> ThreadRegistration& = delete;
+  /**
+   * @brief judge if the calling thread is registered
+   * @return bool judgement result
+   */
+  static auto IsRegistered() -> bool;
+private:
+  void* state_;
+};
+
+/**
+ * @brief scoped GIL release around long C++ work
+ * @note does nothing when the thread does not hold the GIL; touch no Python
+ *       object until this instance is destroyed
+ */
+class GILRelease {
+public:
+  /**
+   * @brief constructor (release the GIL if held)
+   */
+  GILRelease();
+  /**
+   * @brief destructor (take the GIL back)
+   */
+  ~GILRelease();
+  GILRelease(const GILRelease&) = delete;
+  auto operator=(const GILRelease&) -> GILRelease& = delete;
+private:
+  void* state_;
+};
+
+/**
+ * @brief settings of GILExecutor
+ */
+struct GILExecutorConfig {
+  /** @brief maximum count of tasks run per GIL acquisition */
+  size_t max_batch = 64;
+};
+
+/**
+ * @brief executor running tasks on one thread that takes the GIL per batch
+ * @note producers push to a lock-free queue and never touch the GIL, so many
+ *       threads avoid contending on it. do not hold the GIL while waiting on
+ *       results, and destroy the executor before Finalize()
+ */
+class GILExecutor {
+public:
+  /**
+   * @brief constructor (start the executor thread)
+   * @param[in] config executor settings
+   */
+  explicit GILExecutor(const GILExecutorConfig& config = GILExecutorConfig());
+  /**
+   * @brief destructor (finish queued tasks and stop the executor thread)
+   */
+  ~GILExecutor();
+  GILExecutor(const GILExecutor&) = delete;
+  auto operator=(const GILExecutor&) -> GILExecutor& = delete;
+  /**
+   * @brief get count of tasks not finished yet
+   * @return size_t count of tasks
+   */
+  auto Pending() const -> size_t;
+  /**
+   * @brief run task with the GIL held
+   * @param[in] func callable invoked as func()
+   * @return std::future of the result (carries exceptions thrown by func)
+   */
+  template<typename F>
+  auto Submit(F&& func) -> std::future<std::invoke_result_t<F>> {
+    using R = std::invoke_result_t<F>;
+    auto task = std::make_shared<std::packaged_task<R()>>(std::forward<F>(func));
+    auto future = task->get_future();
+    Enqueue([task]() { (*task)(); });
+    return future;
+  }
+  /**
+   * @brief run callback with the GIL held, without result
+   * @param[in] func callable invoked as func()
+   * @note exceptions thrown by func are discarded
+   */
+  auto Post(std::function<void()> func) -> void {
+    Enqueue(std::move(func));
+  }
+private:
+  auto Enqueue(std::function<void()>&& task) -> void;
+  class GILExecutorImpl* pimpl_;
+};
+
+/**
+ * @brief initialize Python interpreter
+ */
+auto Initialize() -> void;
+
+/**
+ * @brief initialize Python interpreter
+ * @param[in] executable_path path to Python executable
+ * @param[in] modules_search_path path to search modules
+ */
+auto Initialize(
+  const std::wstring& executable_path, 
+  const std::wstring& modules_search_path) -> void;
+
+/**
+ * @brief finalize Python interpreter
+ */
+auto Finalize() -> void;
+
+/**
+ * @brief register module loading directory
+ * @param[in] target_path the directory path to target module
+ */
+auto AddModuleDirectory(const std::string& target_path) -> void;
+
+/**
+ * @brief reload Python module
+ * @param[in] module module object to reload
+ * @return Object reloaded module object
+ * @exception std::runtime_error failed to reload
+ * @note every AttributeCache is invalidated
+ */
+auto Reload(const Object& module) -> Object;
+
+/**
+ * @brief settings of the opt-in value cache
+ */
+struct ValueCacheConfig {
+  /** @brief smallest cached integer */
+  long int_min = -128;
+  /** @brief largest cached integer (at most 65536 integers are cached) */
+  long int_max = 1024;
+  /** @brief maximum count of cached strings (least recently used are evicted) */
+  size_t string_capacity = 1024;
+  /** @brief strings longer than this byte length are never cached */
+  size_t string_max_length = 64;
+};
+
+/**
+ * @brief hit/miss counters of the value cache
+ */
+struct ValueCacheStats {
+  size_t int_hits;
+  size_t int_misses;
+  size_t string_hits;
+  size_t string_misses;
+  size_t string_evictions;
+  size_t string_entries;
+};
+
+/**
+ * @brief share int and str objects created from C++ values
+ * @param[in] config cached ranges and capacity
+ * @exception std::out_of_range when int_min exceeds int_max or the integer
+ *            range is too wide
+ * @note applies to Value::FromInt, Value::FromString, Int, Str and ToPython;
+ *       call after Initialize() while holding the GIL.
+ *       the cache belongs to the interpreter running on the calling thread
+ */
+auto EnableValueCache(const ValueCacheConfig& config = ValueCacheConfig()) -> void;
+
+/**
+ * @brief release all cached objects and stop caching
+ * @note called by Finalize()
+ */
+auto DisableValueCache() -> void;
+
+/**
+ * @brief get counters of the value cache
+ * @return ValueCacheStats counters since the cache was enabled
+ */
+auto GetValueCacheStats() -> ValueCacheStats;
+
+/**
+ * @brief one interpreter of InterpreterPool handed to tasks on its worker thread
+ * @note objects obtained here belong to this interpreter only; never pass
+ *       them to another interpreter or keep them after the task returns
+ */
+class Interpreter {
+public:
+  Interpreter(const Interpreter&) = delete;
+  auto operator=(const Interpreter&) -> Interpreter& = delete;
+  /**
+   * @brief get position of the interpreter in the pool
+   * @return size_t index starting from 0
+   */
+  auto Index() const -> size_t;
+  /**
+   * @brief get module imported into this interpreter (imported on first use)
+   * @param[in] name module name
+   * @return const Object& module object
+   * @exception std::runtime_error failed to import
+   */
+  auto Module(const std::string& name) -> const Object&;
+  /**
+   * @brief get function resolved in this interpreter (resolved on first use)
+   * @param[in] module module name
+   * @param[in] name function name
+   * @return const Func& function object
+   * @exception std::runtime_error failed to import
+   * @exception std::logic_error function not found
+   */
+  auto Function(const std::string& module, const std::string& name) -> const Func&;
+private:
+  explicit Interpreter(const size_t& index);
+  ~Interpreter();
+  class InterpreterImpl* pimpl_;
+  friend class InterpreterPoolImpl;
+};
+
+/**
+ * @brief settings of InterpreterPool
+ */
+struct InterpreterPoolConfig {
+  /** @brief count of interpreters (hardware concurrency when 0) */
+  size_t workers = 0;
+  /** @brief modules imported into every interpreter at start */
+  std::vector<std::string> modules;
+};
+
+namespace detail {
+
+/**
+ * @brief judge if T holds Python objects, directly or in standard containers
+ */
+template<typename T, typename Enable = void>
+struct HoldsObject : std::is_base_of<Object, T> {};
+
+template<typename T, typename Allocator>
+struct HoldsObject<std::vector<T, Allocator>> : HoldsObject<T> {};
+
+template<typename T, size_t N>
+struct HoldsObject<std::array<T, N>> : HoldsObject<T> {};
+
+template<typename T>
+struct HoldsObject<std::optional<T>> : HoldsObject<T> {};
+
+template<typename T1, typename T2>
+struct HoldsObject<std::pair<T1, T2>>
+  : std::disjunction<HoldsObject<T1>, HoldsObject<T2>> {};
+
+template<typename... Ts>
+struct HoldsObject<std::tuple<Ts...>> : std::disjunction<HoldsObject<Ts>...> {};
+
+template<typename K, typename V, typename Compare, typename Allocator>
+struct HoldsObject<std::map<K, V, Compare, Allocator>>
+  : std::disjunction<HoldsObject<K>, HoldsObject<V>> {};
+
+template<typename K, typename V, typename Hash, typename Equal, typename Allocator>
+struct HoldsObject<std::unordered_map<K, V, Hash, Equal, Allocator>>
+  : std::disjunction<HoldsObject<K>, HoldsObject<V>> {};
+
+}  // namespace detail
+
+/**
+ * @brief worker threads each owning an isolated sub-interpreter
+ * @note with Python 3.12 or later every sub-interpreter has its own GIL, so
+ *       tasks run on multiple cores in parallel; older versions share the GIL
+ *       and only isolate module state.
+ *       sys.path of the main interpreter is copied at start.
+ *       extension modules without sub-interpreter support (e.g. numpy)
+ *       can not be imported.
+ */
+class InterpreterPool {
+public:
+  /**
+   * @brief constructor (start interpreters)
+   * @param[in] config pool settings
+   * @exception std::runtime_error failed to create interpreter or import modules
+   * @note call while holding the GIL of the main interpreter
+   */
+  explicit InterpreterPool(const InterpreterPoolConfig& config = InterpreterPoolConfig());
+  /**
+   * @brief destructor (finish queued tasks and end interpreters)
+   * @note destroy before Finalize()
+   */
+  ~InterpreterPool();
+  InterpreterPool(const InterpreterPool&) = delete;
+  auto operator=(const InterpreterPool&) -> InterpreterPool& = delete;
+  /**
+   * @brief get count of interpreters
+   * @return size_t count of interpreters
+   */
+  auto Size() const -> size_t;
+  /**
+   * @brief judge if each interpreter runs with its own GIL
+   * @return bool true with Python 3.12 or later
+   */
+  static auto HasOwnGIL() -> bool;
+  /**
+   * @brief run task on any idle interpreter
+   * @param[in] func callable invoked as func(Interpreter&) with its GIL held
+   * @return std::future of the result (carries exceptions thrown by func)
+   * @note return C++ values only (checked at compile time); Python objects
+   *       must not leave the interpreter.
+   *       release the main GIL (e.g. GILContext) before waiting on the future,
+   *       otherwise workers sharing the GIL (Python < 3.12) never run
+   */
+  template<typename F>
+  auto Submit(F&& func) -> std::future<std::invoke_result_t<F, Interpreter&>> {
+    return SubmitTo(Size(), std::forward<F>(func));
+  }
+  /**
+   * @brief run task on the specified interpreter
+   * @param[in] index interpreter index (any interpreter when >= Size())
+   * @param[in] func callable invoked as func(Interpreter&) with its GIL held
+   * @return std::future of the result (carries exceptions thrown by func)
+   * @note tasks for one interpreter run in submission order
+   */
+  template<typename F>
+  auto SubmitTo(const size_t& index, F&& func)
+    -> std::future<std::invoke_result_t<F, Interpreter&>> {
+    using R = std::invoke_result_t<F, Interpreter&>;
+    static_assert(!detail::HoldsObject<std::decay_t<R>>::value,
+      "Python objects must not leave the interpreter of the task");
+    auto task = std::make_shared<std::packaged_task<R(Interpreter&)>>(std::forward<F>(func));
+    auto future = task->get_future();
+    Enqueue(index, [task](Interpreter& interpreter) { (*task)(interpreter); });
+    return future;
+  }
+private:
+  auto Enqueue(const size_t& index, std::function<void(Interpreter&)>&& task) -> void;
+  class InterpreterPoolImpl* pimpl_;
+  friend class ShardedExecutorImpl;
+};
+
+/**
+ * @brief counters of one shard of ShardedExecutor
+ */
+struct ShardStats {
+  /** @brief tasks queued or running now */
+  size_t depth;
+  /** @brief largest depth observed */
+  size_t max_depth;
+  /** @brief tasks submitted in total */
+  size_t submitted;
+  /** @brief tasks finished in total */
+  size_t completed;
+  /** @brief keys moved into this shard by rebalancing */
+  size_t keys_moved_in;
+};
+
+/**
+ * @brief settings of ShardedExecutor
+ */
+struct ShardedExecutorConfig {
+  /** @brief interpreters (one per shard) and modules imported into each */
+  InterpreterPoolConfig pool;
+  /** @brief key hash deciding the home shard (std::hash when empty) */
+  std::function<size_t(const std::string&)> hash;
+  /** @brief read and drop state of a key on its old shard (optional) */
+  std::function<std::string(Interpreter&, const std::string&)> export_state;
+  /** @brief restore state of a key on its new shard (optional) */
+  std::function<void(Interpreter&, const std::string&, const std::string&)> import_state;
+  /** @brief rebalance when the busiest shard exceeds mean load by this ratio */
+  double imbalance = 1.5;
+  /** @brief maximum count of keys moved by one rebalance */
+  size_t max_moves = 1;
+  /**
+   * @brief rebalance automatically every this many submissions (0 disables)
+   * @note when disabled, key loads are halved every 65536 submissions so
+   *       that rarely used keys are forgotten
+   */
+  size_t rebalance_interval = 0;
+};
+
+/**
+ * @brief key-affinity executor over InterpreterPool
+ * @note every task of one key runs on the same interpreter in submission
+ *       order, so per-key Python state stays consistent. rebalancing moves
+ *       hot keys off the busiest shard; their state follows through
+ *       export_state / import_state, or is rebuilt when those are empty.
+ */
+class ShardedExecutor {
+public:
+  /**
+   * @brief constructor (start interpreters)
+   * @param[in] config executor settings
+   * @exception std::runtime_error failed to start interpreters
+   * @note call while holding the GIL of the main interpreter
+   */
+  explicit ShardedExecutor(const ShardedExecutorConfig& config = ShardedExecutorConfig());
+  /**
+   * @brief destructor (finish queued tasks and end interpreters)
+   */
+  ~ShardedExecutor();
+  ShardedExecutor(const ShardedExecutor&) = delete;
+  auto operator=(const ShardedExecutor&) -> ShardedExecutor& = delete;
+  /**
+   * @brief get count of shards
+   * @return size_t count of shards
+   */
+  auto Size() const -> size_t;
+  /**
+   * @brief get shard currently serving the key
+   * @param[in] key routing key
+   * @return size_t shard index
+   */
+  auto ShardOf(const std::string& key) const -> size_t;
+  /**
+   * @brief get counters of every shard
+   * @return std::vector<ShardStats> counters indexed by shard
+   */
+  auto Stats() const -> std::vector<ShardStats>;
+  /**
+   * @brief move hot keys from the busiest shard to the idlest one
+   * @return size_t count of moved keys
+   * @note load is counted per key since the previous rebalance (decayed
+   *       when rebalance_interval is 0)
+   */
+  auto Rebalance() -> size_t;
+  /**
+   * @brief run task on the shard of the key
+   * @param[in] key routing key
+   * @param[in] func callable invoked as func(Interpreter&) with its GIL held
+   * @return std::future of the result (carries exceptions thrown by func)
+   * @note same restrictions as InterpreterPool::Submit
+   */
+  template<typename F>
+  auto Submit(const std::string& key, F&& func)
+    -> std::future<std::invoke_result_t<F, Interpreter&>> {
+    using R = std::invoke_result_t<F, Interpreter&>;
+    static_assert(!detail::HoldsObject<std::decay_t<R>>::value,
+      "Python objects must not leave the interpreter of the task");
+    auto task = std::make_shared<std::packaged_task<R(Interpreter&)>>(std::forward<F>(func));
+    auto future = task->get_future();
+    Enqueue(key, [task](Interpreter& interpreter) { (*task)(interpreter); });
+    return future;
+  }
+private:
+  auto Enqueue(const std::string& key, std::function<void(Interpreter&)>&& task) -> void;
+  class ShardedExecutorImpl* pimpl_;
+};
+
+// short-cut functions
+
+/**
+ * @brief import Python module
+ * @param[in] name module name or script file name (excluding '.py')
+ * @return Object acquired module object
+ */
+inline auto Import(const std::string& name) -> Object {
+  return Object::Load(name);
+}
+
+/**
+ * @brief create new boolean object
+ * @param[in] value input boolean value
+ * @return Value constructed Python object
+ */
+inline auto Bool(const bool& value) -> Value {
+  return poppy::Value::FromBool(value);
+}
+
+/**
+ * @brief create new int object
+ * @param[in] value input int value
+ * @return Value constructed Python object
+ */
+template<typename T>
+inline auto Int(const T& value) -> Value {
+  using Integer = typename std::conditional<
+    std::is_integral<T>::value && !std::is_same<T, bool>::value, T, long>::type;
+  detail::Reference obj(ToPython<Integer>::Convert(static_cast<Integer>(value)));
+  return FromPython<Value>::Convert(obj.ptr);
+}
+
+/**
+ * @brief create new float object
+ * @param[in] value input float value
+ * @return Value constructed Python object
+ */
+template<typename T>
+inline auto Float(const T& value) -> Value {
+  return poppy::Value::FromFloat(value);
+}
+
+/**
+ * @brief create new string object
+ * @param[in] value input string value
+ * @return Value constructed Python object
+ */
+inline auto Str(const std::string& value) -> Value {
+  return poppy::Value::FromString(value);
+}
+
+/**
+ * @brief create new string object
+ * @param[in] value pointer to input string value (utf-8)
+ * @param[in] size byte length of input value
+ * @return Value constructed Python object
+ */
+inline auto Str(const char* value, const size_t& size) -> Value {
+  return poppy::Value::FromString(value, size);
 }
 
 /**
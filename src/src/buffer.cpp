@@ -3,85 +3,170 @@
 
 namespace poppy {
 
-class BufferImpl {
-public:
-  BufferImpl(void* ptr) {
-    auto p = reinterpret_cast<PyObject*>(ptr);
-    PyObject_GetBuffer(p, &buf, PyBUF_STRIDED);
-  }
-  ~BufferImpl() {
-    PyBuffer_Release(&buf);
+#define VIEW_REF(item) reinterpret_cast<PyObject*>((item)->view_)
+#define VIEW_BUF(item) PyMemoryView_GET_BUFFER(VIEW_REF(item))
+
+Buffer::Buffer(void* ptr, BorrowTag tag)
+  : Object(ptr, tag),
+    view_(PyMemoryView_FromObject(reinterpret_cast<PyObject*>(ptr))) {
+  if (!view_) {
+    PyErr_Clear();
+    throw std::bad_cast();
   }
-  Py_buffer buf;
-};
+}
 
-Buffer::Buffer(void* ptr)
-  : ref_(new int(0)),
-    pimpl_(new BufferImpl(ptr)),
-    Object(ptr) {}
+Buffer::Buffer(void* ptr, StealTag tag)
+  : Object(ptr, tag),
+    view_(PyMemoryView_FromObject(reinterpret_cast<PyObject*>(ptr))) {
+  if (!view_) {
+    PyErr_Clear();
+    throw std::bad_cast();
+  }
+}
 
 Buffer::Buffer(const Buffer& obj)
-  : ref_(obj.ref_),
-    pimpl_(obj.pimpl_),
-    Object(obj) {
-  (*ref_)++;
+  : Object(obj),
+    view_(obj.view_) {
+  Py_INCREF(VIEW_REF(this));
+}
+
+Buffer::Buffer(Buffer&& obj) noexcept
+  : Object(std::move(obj)),
+    view_(obj.view_) {
+  obj.view_ = nullptr;
 }
 
 Buffer::~Buffer() {
-  if (*ref_ == 0) {
-    delete pimpl_;
-    pimpl_ = nullptr;
-    delete ref_;
-    ref_ = nullptr;
-  } else {
-    (*ref_)--;
+  if (Py_IsInitialized()) {
+    Py_XDECREF(VIEW_REF(this));
   }
 }
 
 auto Buffer::operator=(const Buffer& obj) -> Buffer& {
-  ref_ = obj.ref_;
-  pimpl_ = obj.pimpl_;
-  (*ref_)++;
+  auto old = VIEW_REF(this);
+  Object::operator=(obj);
+  view_ = obj.view_;
+  Py_INCREF(VIEW_REF(this));
+  Py_XDECREF(old);
+  return *this;
+}
+
+auto Buffer::operator=(Buffer&& obj) noexcept -> Buffer& {
+  if (this != &obj) {
+    auto old = VIEW_REF(this);
+    Object::operator=(std::move(obj));
+    view_ = obj.view_;
+    obj.view_ = nullptr;
+    Py_XDECREF(old);
+  }
   return *this;
 }
 
 auto Buffer::Data() const -> void* {
-  return pimpl_->buf.buf;
+  return VIEW_BUF(this)->buf;
 }
 
 auto Buffer::BytesPerUnit() const -> size_t {
-  return pimpl_->buf.itemsize;
+  return VIEW_BUF(this)->itemsize;
 }
 
 auto Buffer::Length() const -> size_t {
-  return pimpl_->buf.len;
+  return VIEW_BUF(this)->len;
 }
 
 auto Buffer::Format() const -> std::string {
-  if (pimpl_->buf.format) {
-    return pimpl_->buf.format;
+  if (VIEW_BUF(this)->format) {
+    return VIEW_BUF(this)->format;
   }
   return "";
 }
 
 auto Buffer::Dimensions() const -> int {
-  return pimpl_->buf.ndim;
+  return VIEW_BUF(this)->ndim;
 }
 
 auto Buffer::Shape() const -> std::vector<size_t> {
   std::vector<size_t> out;
-  for (int i = 0; i < pimpl_->buf.ndim; ++i) {
-    out.push_back(pimpl_->buf.shape[i]);
+  for (int i = 0; i < VIEW_BUF(this)->ndim; ++i) {
+    out.push_back(VIEW_BUF(this)->shape[i]);
   }
   return out;
 }
 
 auto Buffer::Strides() const -> std::vector<size_t> {
   std::vector<size_t> out;
-  for (int i = 0; i < pimpl_->buf.ndim; ++i) {
-    out.push_back(pimpl_->buf.strides[i]);
+  for (int i = 0; i < VIEW_BUF(this)->ndim; ++i) {
+    out.push_back(VIEW_BUF(this)->strides[i]);
   }
   return out;
 }
 
+auto Buffer::Shape(const int& axis) const -> size_t {
+  if (axis < 0 || axis >= VIEW_BUF(this)->ndim) {
+    throw std::out_of_range("");
+  }
+  return VIEW_BUF(this)->shape[axis];
+}
+
+auto Buffer::Strides(const int& axis) const -> std::ptrdiff_t {
+  if (axis < 0 || axis >= VIEW_BUF(this)->ndim) {
+    throw std::out_of_range("");
+  }
+  return VIEW_BUF(this)->strides[axis];
+}
+
+auto Buffer::ReadOnly() const -> bool {
+  return VIEW_BUF(this)->readonly != 0;
+}
+
+auto Buffer::IsFormat(const char& kind, const size_t& itemsize) const -> bool {
+  if (static_cast<size_t>(VIEW_BUF(this)->itemsize) != itemsize) {
+    return false;
+  }
+  // unsigned bytes when the exporter gives no format
+  const char* format = VIEW_BUF(this)->format ? VIEW_BUF(this)->format : "B";
+  switch (*format) {
+    case '@':
+    case '=':
+#if PY_LITTLE_ENDIAN
+    case '<':
+#else
+    case '>':
+    case '!':
+#endif
+      ++format;
+      break;
+    default:
+      break;
+  }
+  if (format[0] == '\0' || format[1] != '\0') {
+    return false;
+  }
+  switch (format[0]) {
+    case '?':
+      return kind == '?';
+    case 'e':
+    case 'f':
+    case 'd':
+    case 'g':
+      return kind == 'f';
+    case 'b':
+    case 'h':
+    case 'i':
+    case 'l':
+    case 'q':
+    case 'n':
+      return kind == 'i';
+    case 'B':
+    case 'H':
+    case 'I':
+    case 'L':
+    case 'Q':
+    case 'N':
+      return kind == 'u';
+    default:
+      return false;
+  }
+}
+
 }
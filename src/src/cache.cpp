@@ -0,0 +1,46 @@
+#include "internal.h"
+
+namespace poppy {
+
+AttributeCache::AttributeCache(const Object& obj)
+  : target_(obj),
+    entries_(),
+    generation_(internal::ReloadGeneration()) {}
+
+auto AttributeCache::Get(const Name& name) -> Generic {
+  return Get(name.GetRef());
+}
+
+auto AttributeCache::Get(const std::string& name) -> Generic {
+  auto str = internal::InternedName(name);
+  if (!str) {
+    PyErr_Clear();
+    throw std::logic_error("not found");
+  }
+  return Get(str);
+}
+
+auto AttributeCache::Clear() -> void {
+  PyDict_Clear(PYOBJ_REF(&entries_));
+}
+
+auto AttributeCache::Get(void* name) -> Generic {
+  if (generation_ != internal::ReloadGeneration()) {
+    Clear();
+    generation_ = internal::ReloadGeneration();
+  }
+  auto key = reinterpret_cast<PyObject*>(name);
+  auto item = PyDict_GetItemWithError(PYOBJ_REF(&entries_), key);
+  if (item) {
+    return Generic(item, Generic::BorrowTag());
+  }
+  auto attr = PyObject_GetAttr(PYOBJ_REF(&target_), key);
+  if (!attr) {
+    PyErr_Clear();
+    throw std::logic_error("not found");
+  }
+  PyDict_SetItem(PYOBJ_REF(&entries_), key, attr);
+  return Generic(attr, Generic::StealTag());
+}
+
+}
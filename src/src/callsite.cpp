@@ -0,0 +1,134 @@
+#include "poppy.h"
+#include <Python.h>
+
+namespace poppy {
+
+class CallSiteImpl {
+public:
+  CallSiteImpl(PyObject* func, const size_t& arity)
+    : func_(func),
+      call_(PyVectorcall_Function(func)),
+      args_(arity + 1, nullptr) {
+    Py_INCREF(func_);
+    for (size_t i = 1; i < args_.size(); ++i) {
+      Py_INCREF(Py_None);
+      args_[i] = Py_None;
+    }
+  }
+  ~CallSiteImpl() {
+    if (Py_IsInitialized()) {
+      for (size_t i = 1; i < args_.size(); ++i) {
+        Py_DECREF(args_[i]);
+      }
+      Py_DECREF(func_);
+    }
+  }
+  auto Arity() const -> size_t {
+    return args_.size() - 1;
+  }
+  auto Slot(const size_t& index) -> PyObject** {
+    if (index >= Arity()) {
+      throw std::out_of_range("");
+    }
+    return &args_[index + 1];
+  }
+  auto Invoke() -> PyObject* {
+    // leading slot is reserved for the callee (vectorcall offset)
+    auto nargs = Arity() | PY_VECTORCALL_ARGUMENTS_OFFSET;
+    if (call_) {
+      return call_(func_, args_.data() + 1, nargs, NULL);
+    }
+    return PyObject_Vectorcall(func_, args_.data() + 1, nargs, NULL);
+  }
+private:
+  PyObject* func_;
+  vectorcallfunc call_;
+  std::vector<PyObject*> args_;
+};
+
+// replace the reference held by the slot with a new one
+// (the slot is kept when the conversion failed)
+static auto Assign(void** slot, PyObject* value) -> void {
+  if (!value) {
+    PyErr_Clear();
+    throw std::bad_cast();
+  }
+  auto old = reinterpret_cast<PyObject*>(*slot);
+  *slot = value;
+  Py_DECREF(old);
+}
+
+CallSite::CallSite(const Func& func, const size_t& arity)
+  : pimpl_(new CallSiteImpl(PYOBJ_REF(&func), arity)) {}
+
+CallSite::CallSite(CallSite&& obj) noexcept
+  : pimpl_(obj.pimpl_) {
+  obj.pimpl_ = nullptr;
+}
+
+CallSite::~CallSite() {
+  delete pimpl_;
+}
+
+auto CallSite::operator=(CallSite&& obj) noexcept -> CallSite& {
+  if (this != &obj) {
+    delete pimpl_;
+    pimpl_ = obj.pimpl_;
+    obj.pimpl_ = nullptr;
+  }
+  return *this;
+}
+
+auto CallSite::Arity() const -> size_t {
+  return pimpl_->Arity();
+}
+
+auto CallSite::Slot(const size_t& index) -> void** {
+  return reinterpret_cast<void**>(pimpl_->Slot(index));
+}
+
+auto CallSite::Set(const size_t& index, const Object& arg) -> CallSite& {
+  auto slot = Slot(index);
+  Py_INCREF(PYOBJ_REF(&arg));
+  Assign(slot, PYOBJ_REF(&arg));
+  return *this;
+}
+
+auto CallSite::SetBool(const size_t& index, const bool& value) -> CallSite& {
+  auto slot = Slot(index);
+  Assign(slot, PyBool_FromLong(value));
+  return *this;
+}
+
+auto CallSite::SetInt(const size_t& index, const long& value) -> CallSite& {
+  auto slot = Slot(index);
+  Assign(slot, PyLong_FromLong(value));
+  return *this;
+}
+
+auto CallSite::SetFloat(const size_t& index, const double& value) -> CallSite& {
+  auto slot = Slot(index);
+  Assign(slot, PyFloat_FromDouble(value));
+  return *this;
+}
+
+auto CallSite::SetString(const size_t& index, const std::string& value) -> CallSite& {
+  auto slot = Slot(index);
+  Assign(slot, PyUnicode_FromStringAndSize(value.data(), value.size()));
+  return *this;
+}
+
+auto CallSite::Invoke() const -> Generic {
+  auto ret = pimpl_->Invoke();
+  if (!ret) {
+    PyErr_Print();
+    throw std::runtime_error("failed to run function");
+  }
+  return Generic(ret, Generic::StealTag());
+}
+
+auto CallSite::operator()() const -> Generic {
+  return Invoke();
+}
+
+}
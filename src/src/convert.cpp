@@ -0,0 +1,255 @@
+#include "internal.h"
+
+namespace poppy {
+namespace detail {
+
+namespace {
+
+auto Check(PyObject* obj) -> void* {
+  if (!obj) {
+    PyErr_Clear();
+    throw std::bad_cast();
+  }
+  return obj;
+}
+
+}
+
+auto NewNone() -> void* {
+  Py_INCREF(Py_None);
+  return Py_None;
+}
+
+auto NewBool(const bool& value) -> void* {
+  return PyBool_FromLong(value);
+}
+
+auto NewInt(const long long& value) -> void* {
+  if (auto obj = internal::CachedInt(value)) {
+    return obj;
+  }
+  return Check(PyLong_FromLongLong(value));
+}
+
+auto NewUInt(const unsigned long long& value) -> void* {
+  if (value <= static_cast<unsigned long long>(std::numeric_limits<long long>::max())) {
+    return NewInt(static_cast<long long>(value));
+  }
+  return Check(PyLong_FromUnsignedLongLong(value));
+}
+
+auto NewFloat(const double& value) -> void* {
+  return Check(PyFloat_FromDouble(value));
+}
+
+auto NewString(const char* value, const size_t& size) -> void* {
+  if (auto obj = internal::CachedString(value, size)) {
+    return obj;
+  }
+  return Check(PyUnicode_FromStringAndSize(value, size));
+}
+
+auto NewList(const size_t& size) -> void* {
+  return Check(PyList_New(size));
+}
+
+auto NewTuple(const size_t& size) -> void* {
+  return Check(PyTuple_New(size));
+}
+
+auto NewDict() -> void* {
+  return Check(PyDict_New());
+}
+
+auto SetListItem(void* list, const size_t& index, void* item) -> void {
+  PyList_SET_ITEM(reinterpret_cast<PyObject*>(list), index,
+    reinterpret_cast<PyObject*>(item));
+}
+
+auto SetTupleItem(void* tuple, const size_t& index, void* item) -> void {
+  PyTuple_SET_ITEM(reinterpret_cast<PyObject*>(tuple), index,
+    reinterpret_cast<PyObject*>(item));
+}
+
+auto SetDictItem(void* dict, void* key, void* value) -> void {
+  auto ret = PyDict_SetItem(
+    reinterpret_cast<PyObject*>(dict),
+    reinterpret_cast<PyObject*>(key),
+    reinterpret_cast<PyObject*>(value));
+  Py_DECREF(reinterpret_cast<PyObject*>(key));
+  Py_DECREF(reinterpret_cast<PyObject*>(value));
+  if (ret < 0) {
+    PyErr_Clear();
+    throw std::bad_cast();
+  }
+}
+
+auto IsNone(void* obj) -> bool {
+  return obj == Py_None;
+}
+
+auto AsBool(void* obj) -> bool {
+  if (!PyBool_Check(reinterpret_cast<PyObject*>(obj))) {
+    throw std::bad_cast();
+  }
+  return AsExactBool(obj);
+}
+
+auto AsInt(void* obj) -> long long {
+  if (!PyLong_Check(reinterpret_cast<PyObject*>(obj))) {
+    throw std::bad_cast();
+  }
+  return AsExactInt(obj);
+}
+
+auto AsUInt(void* obj) -> unsigned long long {
+  if (!PyLong_Check(reinterpret_cast<PyObject*>(obj))) {
+    throw std::bad_cast();
+  }
+  return AsExactUInt(obj);
+}
+
+auto AsFloat(void* obj) -> double {
+  auto ptr = reinterpret_cast<PyObject*>(obj);
+  if (PyFloat_CheckExact(ptr)) {
+    return AsExactFloat(obj);
+  }
+  if (!PyFloat_Check(ptr) && !PyLong_Check(ptr)) {
+    throw std::bad_cast();
+  }
+  auto value = PyFloat_AsDouble(ptr);
+  if (value == -1.0 && PyErr_Occurred()) {
+    PyErr_Clear();
+    throw std::bad_cast();
+  }
+  return value;
+}
+
+auto AsString(void* obj) -> std::string {
+  if (!PyUnicode_Check(reinterpret_cast<PyObject*>(obj))) {
+    throw std::bad_cast();
+  }
+  return AsExactString(obj);
+}
+
+auto SequenceSize(void* obj) -> size_t {
+  auto ptr = reinterpret_cast<PyObject*>(obj);
+  if (PyTuple_Check(ptr)) {
+    return PyTuple_GET_SIZE(ptr);
+  }
+  if (PyList_Check(ptr)) {
+    return PyList_GET_SIZE(ptr);
+  }
+  throw std::bad_cast();
+}
+
+auto SequenceItem(void* obj, const size_t& index) -> void* {
+  auto ptr = reinterpret_cast<PyObject*>(obj);
+  if (PyTuple_Check(ptr)) {
+    return PyTuple_GET_ITEM(ptr, index);
+  }
+  return PyList_GET_ITEM(ptr, index);
+}
+
+auto SequenceItems(void* obj, size_t& size) -> void* const* {
+  auto ptr = reinterpret_cast<PyObject*>(obj);
+  if (!PyTuple_Check(ptr) && !PyList_Check(ptr)) {
+    throw std::bad_cast();
+  }
+  size = PySequence_Fast_GET_SIZE(ptr);
+  return reinterpret_cast<void* const*>(PySequence_Fast_ITEMS(ptr));
+}
+
+auto DictSize(void* obj) -> size_t {
+  if (!PyDict_Check(reinterpret_cast<PyObject*>(obj))) {
+    throw std::bad_cast();
+  }
+  return PyDict_GET_SIZE(reinterpret_cast<PyObject*>(obj));
+}
+
+auto DictNext(void* obj, std::ptrdiff_t& pos, void*& key, void*& value) -> bool {
+  if (!PyDict_Check(reinterpret_cast<PyObject*>(obj))) {
+    throw std::bad_cast();
+  }
+  Py_ssize_t next = pos;
+  PyObject* k = nullptr;
+  PyObject* v = nullptr;
+  if (!PyDict_Next(reinterpret_cast<PyObject*>(obj), &next, &k, &v)) {
+    return false;
+  }
+  pos = next;
+  key = k;
+  value = v;
+  return true;
+}
+
+auto IsExactType(void* const* items, const size_t& size, const ItemType& type) -> bool {
+  PyTypeObject* exact = nullptr;
+  switch (type) {
+  case ItemType::Bool:
+    exact = &PyBool_Type;
+    break;
+  case ItemType::Int:
+    exact = &PyLong_Type;
+    break;
+  case ItemType::Float:
+    exact = &PyFloat_Type;
+    break;
+  case ItemType::String:
+    exact = &PyUnicode_Type;
+    break;
+  }
+  for (size_t i = 0; i < size; ++i) {
+    if (Py_TYPE(reinterpret_cast<PyObject*>(items[i])) != exact) {
+      return false;
+    }
+  }
+  return true;
+}
+
+auto AsExactBool(void* obj) -> bool {
+  return obj == Py_True;
+}
+
+auto AsExactInt(void* obj) -> long long {
+  auto value = PyLong_AsLongLong(reinterpret_cast<PyObject*>(obj));
+  if (value == -1 && PyErr_Occurred()) {
+    PyErr_Clear();
+    throw std::bad_cast();
+  }
+  return value;
+}
+
+auto AsExactUInt(void* obj) -> unsigned long long {
+  auto value = PyLong_AsUnsignedLongLong(reinterpret_cast<PyObject*>(obj));
+  if (value == static_cast<unsigned long long>(-1) && PyErr_Occurred()) {
+    PyErr_Clear();
+    throw std::bad_cast();
+  }
+  return value;
+}
+
+auto AsExactFloat(void* obj) -> double {
+  return PyFloat_AS_DOUBLE(reinterpret_cast<PyObject*>(obj));
+}
+
+auto AsExactString(void* obj) -> std::string {
+  Py_ssize_t size = 0;
+  auto ptr = PyUnicode_AsUTF8AndSize(reinterpret_cast<PyObject*>(obj), &size);
+  if (!ptr) {
+    PyErr_Clear();
+    throw std::bad_cast();
+  }
+  return std::string(ptr, size);
+}
+
+auto IncRef(void* obj) -> void {
+  Py_INCREF(reinterpret_cast<PyObject*>(obj));
+}
+
+auto DecRef(void* obj) -> void {
+  Py_DECREF(reinterpret_cast<PyObject*>(obj));
+}
+
+}  // namespace detail
+}
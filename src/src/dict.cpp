@@ -3,17 +3,14 @@
 
 namespace poppy {
 
-Dict::Dict(void* ptr)
-  : Object(ptr) {}
-
 Dict::Dict()
-  : Object(Init(std::unordered_map<std::string, Object>())) {}
+  : Object(Init(std::unordered_map<std::string, Object>()), StealTag()) {}
 
 Dict::Dict(const std::unordered_map<std::string, Object>& initializer)
-  : Object(Init(initializer)) {}
+  : Object(Init(initializer), StealTag()) {}
 
 Dict::Dict(const std::unordered_map<Object, Object>& initializer)
-  : Object(Init(initializer)) {}
+  : Object(Init(initializer), StealTag()) {}
 
 auto Dict::Init(const std::unordered_map<std::string, Object>& initializer) -> void* {
   auto dict = PyDict_New();
@@ -40,48 +37,80 @@ auto Dict::Set(const Object& key, const Object& item) const -> void {
 }
 
 auto Dict::Get(const std::string& key) const -> Generic {
-  if (!Contains(key)) {
-    throw std::logic_error("not found");
-  }
-  return Generic(PyDict_GetItemString(PYOBJ_REF(this), key.c_str()));
+  return Get(key.data(), key.size());
 }
 
 auto Dict::Get(const Object& key) const -> Generic {
-  if (!Contains(key)) {
+  auto item = Find(PYOBJ_REF(&key));
+  if (!item) {
     throw std::logic_error("not found");
   }
-  return Generic(PyDict_GetItem(PYOBJ_REF(this), PYOBJ_REF(&key)));
+  return Generic(item, BorrowTag());
 }
 
-auto Dict::Delete(const std::string& key) const -> void {
-  if (!Contains(key)) {
+auto Dict::Get(const char* key, const size_t& length) const -> Generic {
+  auto str = Key(key, length);
+  auto item = Find(PYOBJ_REF(&str));
+  if (!item) {
     throw std::logic_error("not found");
   }
-  PyDict_DelItemString(PYOBJ_REF(this), key.c_str());
+  return Generic(item, BorrowTag());
 }
 
-auto Dict::Delete(const Object& key) const -> void {
-  if (!Contains(key)) {
-    throw std::logic_error("not found");
+auto Dict::TryGet(const std::string& key) const -> std::optional<Generic> {
+  return TryGet(key.data(), key.size());
+}
+
+auto Dict::TryGet(const Object& key) const -> std::optional<Generic> {
+  auto item = Find(PYOBJ_REF(&key));
+  if (!item) {
+    return std::nullopt;
+  }
+  return Generic(item, BorrowTag());
+}
+
+auto Dict::TryGet(const char* key, const size_t& length) const
+  -> std::optional<Generic> {
+  auto str = Key(key, length);
+  auto item = Find(PYOBJ_REF(&str));
+  if (!item) {
+    return std::nullopt;
   }
-  PyDict_DelItem(PYOBJ_REF(this), PYOBJ_REF(&key));
+  return Generic(item, BorrowTag());
+}
+
+auto Dict::Delete(const std::string& key) const -> void {
+  Delete(key.data(), key.size());
+}
+
+auto Dict::Delete(const Object& key) const -> void {
+  Erase(PYOBJ_REF(&key));
+}
+
+auto Dict::Delete(const char* key, const size_t& length) const -> void {
+  auto str = Key(key, length);
+  Erase(PYOBJ_REF(&str));
 }
 
 auto Dict::Contains(const std::string& key) const -> bool {
-  auto str = Value::FromString(key);
-  return PyDict_Contains(PYOBJ_REF(this), PYOBJ_REF(&str));
+  return Contains(key.data(), key.size());
 }
 
 auto Dict::Contains(const Object& key) const -> bool {
-  return PyDict_Contains(PYOBJ_REF(this), PYOBJ_REF(&key));
+  return Find(PYOBJ_REF(&key)) != nullptr;
+}
+
+auto Dict::Contains(const char* key, const size_t& length) const -> bool {
+  auto str = Key(key, length);
+  return Find(PYOBJ_REF(&str)) != nullptr;
 }
 
 auto Dict::GetKeys() const -> List {
-  return List(PyDict_Keys(PYOBJ_REF(this)));
+  return List(PyDict_Keys(PYOBJ_REF(this)), StealTag());
 }
 
 auto Dict::GetValues() const -> List {
-  return List(PyDict_Values(PYOBJ_REF(this)));
+  return List(PyDict_Values(PYOBJ_REF(this)), StealTag());
 }
 
 auto Dict::Size() const -> size_t {
@@ -89,13 +118,67 @@ auto Dict::Size() const -> size_t {
 }
 
 auto Dict::ToStdVector() const -> std::vector<std::pair<Generic, Generic>> {
-  auto keys = GetKeys().ToStdVector();
   std::vector<std::pair<Generic, Generic>> v;
-  for (const auto& key : keys) {
-    auto pair = std::make_pair(key, Get(key));
-    v.push_back(pair);
+  v.reserve(Size());
+  for (const auto& kv : *this) {
+    v.emplace_back(kv.first.ToGeneric(), kv.second.ToGeneric());
   }
   return v;
 }
 
+auto Dict::begin() const -> Iterator {
+  return Iterator(GetRef());
+}
+
+auto Dict::end() const -> Iterator {
+  return Iterator();
+}
+
+Dict::Iterator::Iterator(void* dict) : dict_(dict), pos_(0) {
+  ++(*this);
+}
+
+auto Dict::Iterator::operator++() -> Iterator& {
+  Py_ssize_t pos = pos_;
+  PyObject* key = nullptr;
+  PyObject* value = nullptr;
+  if (PyDict_Next(reinterpret_cast<PyObject*>(dict_), &pos, &key, &value)) {
+    pos_ = pos;
+    item_ = value_type(ObjectView(key), ObjectView(value));
+  }
+  else {
+    // exhausted: become equal to end()
+    dict_ = nullptr;
+    pos_ = 0;
+    item_ = value_type();
+  }
+  return *this;
+}
+
+auto Dict::Key(const char* key, const size_t& length) -> Value {
+  auto str = PyUnicode_FromStringAndSize(key, length);
+  if (!str) {
+    PyErr_Print();
+    throw std::runtime_error("failed to decode key");
+  }
+  return Value(str, StealTag());
+}
+
+auto Dict::Find(void* key) const -> void* {
+  // single hash lookup; a hashing failure is reported as a missing key
+  auto item = PyDict_GetItemWithError(
+    PYOBJ_REF(this), reinterpret_cast<PyObject*>(key));
+  if (!item && PyErr_Occurred()) {
+    PyErr_Clear();
+  }
+  return item;
+}
+
+auto Dict::Erase(void* key) const -> void {
+  if (PyDict_DelItem(PYOBJ_REF(this), reinterpret_cast<PyObject*>(key)) < 0) {
+    PyErr_Clear();
+    throw std::logic_error("not found");
+  }
+}
+
 }
\ No newline at end of file
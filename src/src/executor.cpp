@@ -0,0 +1,161 @@
+#include "internal.h"
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace poppy {
+
+namespace {
+
+// intrusive multi-producer single-consumer queue (D. Vyukov)
+class TaskQueue {
+public:
+  struct Node {
+    std::atomic<Node*> next;
+    std::function<void()> task;
+  };
+  TaskQueue() : head_(&stub_), tail_(&stub_) {
+    stub_.next.store(nullptr, std::memory_order_relaxed);
+  }
+  ~TaskQueue() {
+    while (auto node = Pop()) {
+      delete node;
+    }
+  }
+  // any thread
+  auto Push(Node* node) -> void {
+    node->next.store(nullptr, std::memory_order_relaxed);
+    auto prev = head_.exchange(node, std::memory_order_acq_rel);
+    prev->next.store(node, std::memory_order_release);
+  }
+  // consumer thread only; nullptr when empty or a push is half done
+  auto Pop() -> Node* {
+    auto tail = tail_;
+    auto next = tail->next.load(std::memory_order_acquire);
+    if (tail == &stub_) {
+      if (!next) {
+        return nullptr;
+      }
+      tail_ = next;
+      tail = next;
+      next = next->next.load(std::memory_order_acquire);
+    }
+    if (next) {
+      tail_ = next;
+      return tail;
+    }
+    if (tail != head_.load(std::memory_order_acquire)) {
+      return nullptr;
+    }
+    Push(&stub_);
+    next = tail->next.load(std::memory_order_acquire);
+    if (next) {
+      tail_ = next;
+      return tail;
+    }
+    return nullptr;
+  }
+private:
+  std::atomic<Node*> head_;
+  Node* tail_;
+  Node stub_;
+};
+
+}
+
+class GILExecutorImpl {
+public:
+  explicit GILExecutorImpl(const GILExecutorConfig& config)
+    : max_batch_(std::max<size_t>(1, config.max_batch)),
+      pending_(0),
+      sleeping_(false),
+      stopping_(false),
+      thread_([this]() { Run(); }) {}
+  ~GILExecutorImpl() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stopping_ = true;
+    }
+    wake_.notify_one();
+    // the executor thread needs the GIL to finish queued tasks
+    GILRelease release;
+    thread_.join();
+  }
+  auto Pending() const -> size_t {
+    return pending_.load(std::memory_order_relaxed);
+  }
+  auto Enqueue(std::function<void()>&& task) -> void {
+    auto node = new TaskQueue::Node();
+    node->task = std::move(task);
+    queue_.Push(node);
+    pending_.fetch_add(1);
+    if (sleeping_.load()) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      wake_.notify_one();
+    }
+  }
+private:
+  auto Run() -> void {
+    auto state = PyThreadState_New(PyInterpreterState_Main());
+    while (Wait()) {
+      internal::RestoreThread(state);
+      for (size_t i = 0; i < max_batch_ && pending_.load(std::memory_order_relaxed); ) {
+        auto node = queue_.Pop();
+        if (!node) {
+          // a producer is between its exchange and link
+          std::this_thread::yield();
+          continue;
+        }
+        try {
+          node->task();
+        }
+        catch (...) {
+          // Post() callbacks have nobody to report to
+        }
+        delete node;
+        pending_.fetch_sub(1, std::memory_order_relaxed);
+        ++i;
+      }
+      internal::SaveThread();
+    }
+    internal::RestoreThread(state);
+    internal::DeleteCurrentThread();
+  }
+  // block until tasks arrive; false once stopped and drained
+  auto Wait() -> bool {
+    if (pending_.load()) {
+      return true;
+    }
+    std::unique_lock<std::mutex> lock(mutex_);
+    sleeping_.store(true);
+    wake_.wait(lock, [this]() { return stopping_ || pending_.load(); });
+    sleeping_.store(false);
+    return pending_.load() != 0;
+  }
+  size_t max_batch_;
+  TaskQueue queue_;
+  std::atomic<size_t> pending_;
+  std::atomic<bool> sleeping_;
+  std::mutex mutex_;
+  std::condition_variable wake_;
+  bool stopping_;
+  std::thread thread_;
+};
+
+GILExecutor::GILExecutor(const GILExecutorConfig& config)
+  : pimpl_(new GILExecutorImpl(config)) {}
+
+GILExecutor::~GILExecutor() {
+  delete pimpl_;
+}
+
+auto GILExecutor::Pending() const -> size_t {
+  return pimpl_->Pending();
+}
+
+auto GILExecutor::Enqueue(std::function<void()>&& task) -> void {
+  pimpl_->Enqueue(std::move(task));
+}
+
+}
@@ -3,23 +3,22 @@
 
 namespace poppy {
 
-Func::Func(void* ptr)
-  : Object(ptr) {}
-
 auto Func::Invoke() const -> Generic {
   auto ret = PyObject_CallNoArgs(PYOBJ_REF(this));
   if (!ret) {
+    PyErr_Print();
     throw std::runtime_error("failed to run function");
   }
-  return Generic(ret);
+  return Generic(ret, StealTag());
 }
 
 auto Func::Invoke(const Object& arg) const -> Generic {
   auto ret = PyObject_CallOneArg(PYOBJ_REF(this), PYOBJ_REF(&arg));
   if (!ret) {
+    PyErr_Print();
     throw std::runtime_error("failed to run function");
   }
-  return Generic(ret);
+  return Generic(ret, StealTag());
 }
 
 auto Func::operator()() const -> Generic {
@@ -30,12 +29,76 @@ auto Func::operator()(const Object& arg) const -> Generic {
   return Invoke(arg);
 }
 
-auto Func::InvokeTuple(const Tuple& args) const -> Generic {
-  auto ret = PyObject_CallObject(PYOBJ_REF(this), PYOBJ_REF(&args));
+auto Func::InvokeVector(
+  void** args,
+  const size_t& size,
+  const Keywords* keywords) const -> Generic {
+  auto positional = size;
+  if (keywords) {
+    if (keywords->Size() > size) {
+      throw std::logic_error("too few arguments for keywords");
+    }
+    positional -= keywords->Size();
+  }
+  auto ret = PyObject_Vectorcall(
+    PYOBJ_REF(this),
+    reinterpret_cast<PyObject**>(args) + 1,
+    positional | PY_VECTORCALL_ARGUMENTS_OFFSET,
+    keywords ? PYOBJ_REF(keywords) : NULL);
+  if (!ret) {
+    PyErr_Print();
+    throw std::runtime_error("failed to run function");
+  }
+  return Generic(ret, StealTag());
+}
+
+auto Func::InvokeRaw(void** args, const size_t& size) const -> void* {
+  auto ret = PyObject_Vectorcall(
+    PYOBJ_REF(this),
+    reinterpret_cast<PyObject**>(args) + 1,
+    size | PY_VECTORCALL_ARGUMENTS_OFFSET,
+    NULL);
   if (!ret) {
+    PyErr_Print();
     throw std::runtime_error("failed to run function");
   }
-  return Generic(ret);
+  return ret;
+}
+
+auto Func::InvokeBatch(
+  const size_t& count,
+  const size_t& arity,
+  const std::function<void(const size_t&, void**)>& bind,
+  const std::function<void(const size_t&, void*)>& store) const -> void {
+  // PyGILState_Ensure would deadlock inside a sub-interpreter task
+  GILAcquire lock;
+  // leading slot is reserved for the callee (vectorcall offset)
+  struct Arguments {
+    explicit Arguments(const size_t& arity) : items(arity + 1, nullptr) {}
+    ~Arguments() { Clear(); }
+    auto Clear() -> void {
+      for (auto& item : items) {
+        Py_CLEAR(item);
+      }
+    }
+    std::vector<PyObject*> items;
+  } args(arity);
+  auto func = PYOBJ_REF(this);
+  auto call = PyVectorcall_Function(func);
+  auto nargs = arity | PY_VECTORCALL_ARGUMENTS_OFFSET;
+  for (size_t i = 0; i < count; ++i) {
+    bind(i, reinterpret_cast<void**>(args.items.data() + 1));
+    auto ret = call
+      ? call(func, args.items.data() + 1, nargs, NULL)
+      : PyObject_Vectorcall(func, args.items.data() + 1, nargs, NULL);
+    args.Clear();
+    if (!ret) {
+      PyErr_Print();
+      throw std::runtime_error("failed to run function");
+    }
+    detail::Reference result(ret);
+    store(i, ret);
+  }
 }
 
 }
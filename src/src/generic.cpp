@@ -3,9 +3,6 @@
 
 namespace poppy {
 
-Generic::Generic(void* ptr)
-  : Object(ptr) {}
-
 auto Generic::IsValue() const -> bool {
   auto ptr = GetRef();
   return
@@ -37,49 +34,97 @@ auto Generic::IsFunc() const -> bool {
   return PyCallable_Check(PYOBJ_REF(this));
 }
 
-auto Generic::ToValue() const -> Value {
+auto Generic::ToValue() const& -> Value {
+  if (IsValue()) {
+    return Value(GetRef(), BorrowTag());
+  } else {
+    throw std::bad_cast();
+  }
+}
+
+auto Generic::ToValue() && -> Value {
   if (IsValue()) {
-    return Value(GetRef());
+    return Value(Release(), StealTag());
   } else {
     throw std::bad_cast();
   }
 }
 
-auto Generic::ToTuple() const -> Tuple {
+auto Generic::ToTuple() const& -> Tuple {
   if (IsTuple()) {
-    return Tuple(GetRef());
+    return Tuple(GetRef(), BorrowTag());
+  } else {
+    throw std::bad_cast();
+  }
+}
+
+auto Generic::ToTuple() && -> Tuple {
+  if (IsTuple()) {
+    return Tuple(Release(), StealTag());
+  } else {
+    throw std::bad_cast();
+  }
+}
+
+auto Generic::ToList() const& -> List {
+  if (IsList()) {
+    return List(GetRef(), BorrowTag());
   } else {
     throw std::bad_cast();
   }
 }
 
-auto Generic::ToList() const -> List {
+auto Generic::ToList() && -> List {
   if (IsList()) {
-    return List(GetRef());
+    return List(Release(), StealTag());
   } else {
     throw std::bad_cast();
   }
 }
 
-auto Generic::ToDict() const -> Dict {
+auto Generic::ToDict() const& -> Dict {
   if (IsDict()) {
-    return Dict(GetRef());
+    return Dict(GetRef(), BorrowTag());
   } else {
     throw std::bad_cast();
   }
 }
 
-auto Generic::ToBuffer() const -> Buffer {
+auto Generic::ToDict() && -> Dict {
+  if (IsDict()) {
+    return Dict(Release(), StealTag());
+  } else {
+    throw std::bad_cast();
+  }
+}
+
+auto Generic::ToBuffer() const& -> Buffer {
+  if (IsBuffer()) {
+    return Buffer(GetRef(), BorrowTag());
+  } else {
+    throw std::bad_cast();
+  }
+}
+
+auto Generic::ToBuffer() && -> Buffer {
   if (IsBuffer()) {
-    return Buffer(GetRef());
+    return Buffer(Release(), StealTag());
+  } else {
+    throw std::bad_cast();
+  }
+}
+
+auto Generic::ToFunc() const& -> Func {
+  if (IsFunc()) {
+    return Func(GetRef(), BorrowTag());
   } else {
     throw std::bad_cast();
   }
 }
 
-auto Generic::ToFunc() const -> Func {
+auto Generic::ToFunc() && -> Func {
   if (IsFunc()) {
-    return Func(GetRef());
+    return Func(Release(), StealTag());
   } else {
     throw std::bad_cast();
   }
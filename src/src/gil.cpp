@@ -1,32 +1,124 @@
-#include "poppy.h"
-#include <Python.h>
+#include "internal.h"
+#include <algorithm>
+#include <vector>
 
 namespace poppy {
 
+namespace {
+
+// locks taken through GILContext by the calling thread (innermost last)
+thread_local std::vector<std::pair<const GILContextImpl*, int>> context_locks;
+
+// thread state prepared by ThreadRegistration for the calling thread
+struct Registration {
+  PyThreadState* state = nullptr;
+  // whether TakeGIL() made the state current
+  bool swapped_in = false;
+};
+thread_local Registration registration;
+
+// TakeGIL() results besides PyGILState_STATE values
+const int already_held = -1;
+const int registered_lock = -2;
+
+#if PY_VERSION_HEX < 0x030C0000
+// whether the calling thread holds a GIL; the current thread state can not
+// tell, as it is shared by all threads before Python 3.12
+thread_local bool gil_held = false;
+#endif
+
+}
+
+auto internal::HoldsGIL() -> bool {
+#if PY_VERSION_HEX >= 0x030D0000
+  return PyThreadState_GetUnchecked() != nullptr;
+#elif PY_VERSION_HEX >= 0x030C0000
+  return _PyThreadState_UncheckedGet() != nullptr;
+#else
+  return gil_held;
+#endif
+}
+
+auto internal::MarkGIL(const bool& held) -> void {
+#if PY_VERSION_HEX < 0x030C0000
+  gil_held = held;
+#else
+  static_cast<void>(held);
+#endif
+}
+
+namespace {
+
+// acquire the GIL for the calling thread, preferring its registered state
+auto TakeGIL() -> int {
+  if (internal::HoldsGIL()) {
+    return already_held;
+  }
+  if (registration.state) {
+    internal::RestoreThread(registration.state);
+    registration.swapped_in = true;
+    return registered_lock;
+  }
+  auto state = PyGILState_Ensure();
+  internal::MarkGIL(true);
+  return static_cast<int>(state);
+}
+
+// undo TakeGIL() with its result
+auto DropGIL(const int& lock) -> void {
+  if (lock == registered_lock) {
+    registration.swapped_in = false;
+    internal::SaveThread();
+  } else if (lock != already_held) {
+    auto state = static_cast<PyGILState_STATE>(lock);
+    PyGILState_Release(state);
+    // still held when taken on top of a holder outside of this library
+    internal::MarkGIL(state == PyGILState_LOCKED);
+  }
+}
+
+}
+
+auto internal::RestoreThread(PyThreadState* state) -> void {
+  PyEval_RestoreThread(state);
+  MarkGIL(true);
+}
+
+auto internal::SaveThread() -> PyThreadState* {
+  MarkGIL(false);
+  return PyEval_SaveThread();
+}
+
+auto internal::DeleteCurrentThread() -> void {
+  PyThreadState_Clear(PyThreadState_Get());
+  MarkGIL(false);
+  PyThreadState_DeleteCurrent();
+}
+
 class GILContextImpl {
 public:
   GILContextImpl()
-    : locking_(false),
-      state_(),
-      context_(PyEval_SaveThread()) {}
+    : context_(internal::SaveThread()) {}
   ~GILContextImpl() {
-    if (locking_) {
-      Unlock();
-    }
-    PyEval_RestoreThread(context_);
+    while (Unlock()) {}
+    internal::RestoreThread(context_);
   }
   auto Lock() -> void {
-    state_ = PyGILState_Ensure();
-    locking_ = true;
+    context_locks.emplace_back(this, TakeGIL());
   }
-  auto Unlock() -> void {
-    PyGILState_Release(state_);
-    locking_ = false;
+  auto Unlock() -> bool {
+    auto it = std::find_if(context_locks.rbegin(), context_locks.rend(),
+      [this](const auto& lock) { return lock.first == this; });
+    if (it == context_locks.rend()) {
+      return false;
+    }
+    auto lock = it->second;
+    context_locks.erase(std::next(it).base());
+    DropGIL(lock);
+    return true;
   }
 private:
   PyThreadState* context_;
-  PyGILState_STATE state_;
-  bool locking_;
 };
 
 GILContext::GILContext()
@@ -56,7 +148,9 @@ auto GILContext::Unlock() -> void {
   if (released_) {
     throw std::runtime_error("attempt to use the released object");
   }
-  pimpl_->Unlock();
+  if (!pimpl_->Unlock()) {
+    throw std::logic_error("not locked");
+  }
 }
 
 auto GILContext::Scope(const std::function<void(void)>& func) -> void {
@@ -65,4 +159,50 @@ auto GILContext::Scope(const std::function<void(void)>& func) -> void {
   Unlock();
 }
 
+GILAcquire::GILAcquire()
+  : state_(TakeGIL()) {}
+
+GILAcquire::~GILAcquire() {
+  DropGIL(state_);
+}
+
+ThreadRegistration::ThreadRegistration()
+  : state_(nullptr) {
+  if (!registration.state) {
+    registration.state = PyThreadState_New(PyInterpreterState_Main());
+    state_ = registration.state;
+  }
+}
+
+ThreadRegistration::~ThreadRegistration() {
+  if (!state_) {
+    return;
+  }
+  auto state = reinterpret_cast<PyThreadState*>(state_);
+  if (registration.swapped_in || !internal::HoldsGIL()) {
+    if (!registration.swapped_in) {
+      internal::RestoreThread(state);
+    }
+    internal::DeleteCurrentThread();
+  } else {
+    // the GIL is held through another thread state of this thread
+    PyThreadState_Clear(state);
+    PyThreadState_Delete(state);
+  }
+  registration = {};
+}
+
+auto ThreadRegistration::IsRegistered() -> bool {
+  return registration.state != nullptr;
+}
+
+GILRelease::GILRelease()
+  : state_(internal::HoldsGIL() ? internal::SaveThread() : nullptr) {}
+
+GILRelease::~GILRelease() {
+  if (state_) {
+    internal::RestoreThread(reinterpret_cast<PyThreadState*>(state_));
+  }
+}
+
 }
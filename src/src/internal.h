@@ -0,0 +1,118 @@
+#ifndef POPPY_INTERNAL_H_
+#define POPPY_INTERNAL_H_
+
+#include "poppy.h"
+#include <Python.h>
+#include <list>
+#include <string_view>
+
+namespace poppy {
+namespace internal {
+
+/**
+ * @brief shared objects handed out instead of creating new ones
+ */
+struct ValueCache {
+  bool enabled = false;
+  ValueCacheConfig config;
+  ValueCacheStats stats = {};
+  std::vector<PyObject*> ints;
+  // most recently used first; keys of the index view into the list nodes
+  std::list<std::pair<std::string, PyObject*>> strings;
+  std::unordered_map<std::string_view, decltype(strings)::iterator> index;
+};
+
+/**
+ * @brief caches bound to one interpreter (objects must not cross interpreters)
+ */
+struct InterpreterState {
+  std::unordered_map<std::string, PyObject*> names;
+  ValueCache values;
+  PyObject* memory_type = nullptr;
+};
+
+/**
+ * @brief get caches of the interpreter running on the calling thread
+ * @return InterpreterState& caches guarded by the GIL of the interpreter
+ */
+auto CurrentState() -> InterpreterState&;
+
+/**
+ * @brief release and forget caches of the interpreter running on the calling thread
+ * @note call right before the interpreter is finalized
+ */
+auto ClearState() -> void;
+
+/**
+ * @brief get interned unicode object of the name
+ * @param[in] name attribute or method name
+ * @return PyObject* borrowed reference kept until Finalize()
+ */
+auto InternedName(const std::string& name) -> PyObject*;
+
+/**
+ * @brief release all cached names before finalizing the interpreter
+ */
+auto ClearInternedNames() -> void;
+
+/**
+ * @brief release the Python type used by Buffer::FromMemory
+ */
+auto ClearMemoryType() -> void;
+
+/**
+ * @brief get shared int object from the value cache
+ * @param[in] value integer value
+ * @return PyObject* new reference, or nullptr when not cached
+ */
+auto CachedInt(const long long& value) -> PyObject*;
+
+/**
+ * @brief get shared str object from the value cache
+ * @param[in] value pointer to utf-8 characters
+ * @param[in] size byte length
+ * @return PyObject* new reference, or nullptr when not cached
+ */
+auto CachedString(const char* value, const size_t& size) -> PyObject*;
+
+/**
+ * @brief get count of module reloads, used to invalidate caches
+ * @return size_t reload generation
+ */
+auto ReloadGeneration() -> size_t;
+
+/**
+ * @brief judge if the calling thread holds the GIL of any interpreter
+ * @return bool judgement result
+ * @note before Python 3.12 the current thread state is process-wide, so
+ *       ownership is tracked per thread by the functions below
+ */
+auto HoldsGIL() -> bool;
+
+/**
+ * @brief record that the calling thread took or dropped the GIL
+ * @param[in] held whether the thread holds the GIL from now on
+ */
+auto MarkGIL(const bool& held) -> void;
+
+/**
+ * @brief take the GIL with the thread state (PyEval_RestoreThread)
+ * @param[in] state thread state created for the calling thread
+ */
+auto RestoreThread(PyThreadState* state) -> void;
+
+/**
+ * @brief release the GIL (PyEval_SaveThread)
+ * @return PyThreadState* thread state to be restored later
+ */
+auto SaveThread() -> PyThreadState*;
+
+/**
+ * @brief clear and delete the current thread state, releasing the GIL
+ */
+auto DeleteCurrentThread() -> void;
+
+}  // namespace internal
+}  // namespace poppy
+
+#endif  // POPPY_INTERNAL_H_
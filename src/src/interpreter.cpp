@@ -0,0 +1,303 @@
+#include "internal.h"
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+namespace poppy {
+
+namespace {
+
+// caches of every live interpreter, keyed by interpreter
+std::mutex states_mutex;
+std::unordered_map<PyInterpreterState*, std::unique_ptr<internal::InterpreterState>> states;
+// bumped whenever an interpreter goes away, so that stale slots are dropped
+std::atomic<size_t> states_epoch(0);
+
+// last lookup of the calling thread
+struct StateSlot {
+  PyInterpreterState* interpreter = nullptr;
+  size_t epoch = 0;
+  internal::InterpreterState* state = nullptr;
+};
+
+thread_local StateSlot current_slot;
+
+auto NewInterpreter() -> PyThreadState* {
+#if PY_VERSION_HEX >= 0x030C0000
+  PyInterpreterConfig config = {};
+  config.use_main_obmalloc = 0;
+  config.allow_fork = 0;
+  config.allow_exec = 0;
+  config.allow_threads = 1;
+  config.allow_daemon_threads = 0;
+  config.check_multi_interp_extensions = 1;
+  config.gil = PyInterpreterConfig_OWN_GIL;
+  PyThreadState* state = nullptr;
+  auto status = Py_NewInterpreterFromConfig(&state, &config);
+  if (PyStatus_Exception(status)) {
+    return nullptr;
+  }
+  return state;
+#else
+  return Py_NewInterpreter();
+#endif
+}
+
+}
+
+namespace internal {
+
+auto CurrentState() -> InterpreterState& {
+  auto interpreter = PyInterpreterState_Get();
+  auto epoch = states_epoch.load(std::memory_order_acquire);
+  if (current_slot.interpreter == interpreter && current_slot.epoch == epoch) {
+    return *current_slot.state;
+  }
+  std::lock_guard<std::mutex> lock(states_mutex);
+  auto& state = states[interpreter];
+  if (!state) {
+    state.reset(new InterpreterState());
+  }
+  current_slot.interpreter = interpreter;
+  current_slot.epoch = states_epoch.load(std::memory_order_relaxed);
+  current_slot.state = state.get();
+  return *state;
+}
+
+auto ClearState() -> void {
+  ClearInternedNames();
+  DisableValueCache();
+  ClearMemoryType();
+  std::lock_guard<std::mutex> lock(states_mutex);
+  states.erase(PyInterpreterState_Get());
+  states_epoch.fetch_add(1, std::memory_order_release);
+}
+
+}  // namespace internal
+
+class InterpreterImpl {
+public:
+  explicit InterpreterImpl(const size_t& index) : index_(index) {}
+  auto Index() const -> size_t {
+    return index_;
+  }
+  auto Module(const std::string& name) -> const Object& {
+    auto it = modules_.find(name);
+    if (it == modules_.end()) {
+      it = modules_.emplace(name, Import(name)).first;
+    }
+    return it->second;
+  }
+  auto Function(const std::string& module, const std::string& name) -> const Func& {
+    auto key = module + "." + name;
+    auto it = functions_.find(key);
+    if (it == functions_.end()) {
+      it = functions_.emplace(key, Module(module).GetAttribute(name).ToFunc()).first;
+    }
+    return it->second;
+  }
+private:
+  size_t index_;
+  std::unordered_map<std::string, Object> modules_;
+  std::unordered_map<std::string, Func> functions_;
+};
+
+Interpreter::Interpreter(const size_t& index)
+  : pimpl_(new InterpreterImpl(index)) {}
+
+Interpreter::~Interpreter() {
+  delete pimpl_;
+}
+
+auto Interpreter::Index() const -> size_t {
+  return pimpl_->Index();
+}
+
+auto Interpreter::Module(const std::string& name) -> const Object& {
+  return pimpl_->Module(name);
+}
+
+auto Interpreter::Function(
+  const std::string& module,
+  const std::string& name) -> const Func& {
+  return pimpl_->Function(module, name);
+}
+
+class InterpreterPoolImpl {
+public:
+  explicit InterpreterPoolImpl(const InterpreterPoolConfig& config)
+    : main_(PyInterpreterState_Main()),
+      modules_(config.modules),
+      queues_(config.workers
+        ? config.workers : std::max(1u, std::thread::hardware_concurrency())),
+      started_(0),
+      failed_(false),
+      stopping_(false) {
+    auto path = PySys_GetObject("path");
+    for (Py_ssize_t i = 0; path && i < PyList_Size(path); ++i) {
+      if (auto str = PyUnicode_AsUTF8(PyList_GET_ITEM(path, i))) {
+        paths_.emplace_back(str);
+      } else {
+        PyErr_Clear();
+      }
+    }
+    for (size_t i = 0; i < queues_.size(); ++i) {
+      threads_.emplace_back([this, i]() { Run(i); });
+    }
+    // workers need the main GIL to create their interpreters
+    GILRelease release;
+    std::unique_lock<std::mutex> lock(mutex_);
+    ready_.wait(lock, [this]() { return started_ == threads_.size(); });
+  }
+  ~InterpreterPoolImpl() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stopping_ = true;
+    }
+    wake_.notify_all();
+    GILRelease release;
+    for (auto& th : threads_) {
+      th.join();
+    }
+  }
+  auto Size() const -> size_t {
+    return queues_.size();
+  }
+  auto Failed() const -> bool {
+    return failed_;
+  }
+  auto Enqueue(const size_t& index, std::function<void(Interpreter&)>&& task) -> void {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (index < queues_.size()) {
+        queues_[index].push_back(std::move(task));
+      } else {
+        shared_.push_back(std::move(task));
+      }
+    }
+    // a task bound to one worker must wake that worker, so wake all
+    if (index < queues_.size()) {
+      wake_.notify_all();
+    } else {
+      wake_.notify_one();
+    }
+  }
+private:
+  auto Next(const size_t& index, std::function<void(Interpreter&)>& task) -> bool {
+    std::unique_lock<std::mutex> lock(mutex_);
+    auto& own = queues_[index];
+    wake_.wait(lock, [this, &own]() {
+      return stopping_ || !own.empty() || !shared_.empty();
+    });
+    auto& queue = !own.empty() ? own : shared_;
+    if (queue.empty()) {
+      return false;
+    }
+    task = std::move(queue.front());
+    queue.pop_front();
+    return true;
+  }
+  auto Ready(const bool& ok) -> void {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      started_++;
+      failed_ = failed_ || !ok;
+    }
+    ready_.notify_all();
+  }
+  auto Setup(Interpreter& interpreter) -> bool {
+    auto path = PyList_New(0);
+    for (const auto& p : paths_) {
+      auto str = PyUnicode_DecodeFSDefault(p.c_str());
+      PyList_Append(path, str);
+      Py_DECREF(str);
+    }
+    PySys_SetObject("path", path);
+    Py_DECREF(path);
+    try {
+      for (const auto& m : modules_) {
+        interpreter.Module(m);
+      }
+    }
+    catch (const std::exception&) {
+      return false;
+    }
+    return true;
+  }
+  auto Run(const size_t& index) -> void {
+    auto main_state = PyThreadState_New(main_);
+    internal::RestoreThread(main_state);
+    auto state = NewInterpreter();
+    if (!state) {
+      PyErr_Clear();
+      internal::DeleteCurrentThread();
+      Ready(false);
+      return;
+    }
+    {
+      Interpreter interpreter(index);
+      auto ok = Setup(interpreter);
+      internal::SaveThread();
+      Ready(ok);
+      std::function<void(Interpreter&)> task;
+      while (ok && Next(index, task)) {
+        internal::RestoreThread(state);
+        task(interpreter);
+        task = nullptr;
+        internal::SaveThread();
+      }
+      internal::RestoreThread(state);
+    }
+    internal::ClearState();
+    Py_EndInterpreter(state);
+#if PY_VERSION_HEX >= 0x030C0000
+    // the main GIL was released when the interpreter took its own
+    internal::RestoreThread(main_state);
+#else
+    PyThreadState_Swap(main_state);
+#endif
+    internal::DeleteCurrentThread();
+  }
+  PyInterpreterState* main_;
+  std::vector<std::string> modules_;
+  std::vector<std::string> paths_;
+  std::vector<std::deque<std::function<void(Interpreter&)>>> queues_;
+  std::deque<std::function<void(Interpreter&)>> shared_;
+  std::vector<std::thread> threads_;
+  std::mutex mutex_;
+  std::condition_variable wake_;
+  std::condition_variable ready_;
+  size_t started_;
+  bool failed_;
+  bool stopping_;
+};
+
+InterpreterPool::InterpreterPool(const InterpreterPoolConfig& config)
+  : pimpl_(new InterpreterPoolImpl(config)) {
+  if (pimpl_->Failed()) {
+    delete pimpl_;
+    throw std::runtime_error("failed to start interpreter");
+  }
+}
+
+InterpreterPool::~InterpreterPool() {
+  delete pimpl_;
+}
+
+auto InterpreterPool::Size() const -> size_t {
+  return pimpl_->Size();
+}
+
+auto InterpreterPool::HasOwnGIL() -> bool {
+  return PY_VERSION_HEX >= 0x030C0000;
+}
+
+auto InterpreterPool::Enqueue(
+  const size_t& index,
+  std::function<void(Interpreter&)>&& task) -> void {
+  pimpl_->Enqueue(index, std::move(task));
+}
+
+}
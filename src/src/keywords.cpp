@@ -0,0 +1,22 @@
+#include "poppy.h"
+#include <Python.h>
+
+namespace poppy {
+
+Keywords::Keywords(const std::vector<std::string>& names)
+  : Object(Init(names), StealTag()) {}
+
+auto Keywords::Init(const std::vector<std::string>& names) -> void* {
+  auto tuple = PyTuple_New(names.size());
+  int i = 0;
+  for (const auto& name : names) {
+    PyTuple_SetItem(tuple, i++, PyUnicode_InternFromString(name.c_str()));
+  }
+  return tuple;
+}
+
+auto Keywords::Size() const -> size_t {
+  return PyTuple_GET_SIZE(PYOBJ_REF(this));
+}
+
+}
@@ -1,25 +1,26 @@
 #include "poppy.h"
 #include <Python.h>
+#include <cassert>
 
 namespace poppy {
 
-List::List(void* ptr) 
-  : Object(ptr) {}
-
 List::List(const std::vector<Object>& initializer)
-  : Object(Init(initializer)) {}
+  : Object(Init(initializer), StealTag()) {}
 
 auto List::Init(const std::vector<Object>& initializer) -> void* {
   auto list = PyList_New(initializer.size());
   int i = 0;
   for (const auto& item : initializer) {
+    Py_INCREF(PYOBJ_REF(&item));
     PyList_SetItem(list, i++, PYOBJ_REF(&item));
   }
   return list;
 }
 
 auto List::Set(const int& index, const Object& item) const -> void {
+  Py_INCREF(PYOBJ_REF(&item));
   if (PyList_SetItem(PYOBJ_REF(this), index, PYOBJ_REF(&item)) < 0) {
+    PyErr_Clear();
     throw std::out_of_range("");
   }
 }
@@ -27,9 +28,10 @@ auto List::Set(const int& index, const Object& item) const -> void {
 auto List::Get(const int& index) const -> Generic {
   auto obj = PyList_GetItem(PYOBJ_REF(this), index);
   if (!obj) {
+    PyErr_Clear();
     throw std::out_of_range("");
   }
-  return Generic(obj);
+  return Generic(obj, BorrowTag());
 }
 
 auto List::Insert(const int& index, const Object& item) const -> void {
@@ -56,15 +58,30 @@ auto List::Size() const -> size_t {
 }
 
 auto List::ToTuple() const -> Tuple {
-  return Tuple(PyList_AsTuple(PYOBJ_REF(this)));
+  return Tuple(PyList_AsTuple(PYOBJ_REF(this)), StealTag());
 }
 
 auto List::ToStdVector() const -> std::vector<Generic> {
   std::vector<Generic> v;
-  for (int i = 0; i < Size(); ++i) {
-    v.push_back(Get(i));
+  v.reserve(Size());
+  for (const auto& item : *this) {
+    v.push_back(item.ToGeneric());
   }
   return v;
 }
 
+auto List::operator[](const size_t& index) const -> ObjectView {
+  assert(index < static_cast<size_t>(PyList_GET_SIZE(PYOBJ_REF(this))));
+  return ObjectView(PyList_GET_ITEM(PYOBJ_REF(this), index));
+}
+
+auto List::begin() const -> Iterator {
+  return Iterator(reinterpret_cast<void* const*>(
+    reinterpret_cast<PyListObject*>(PYOBJ_REF(this))->ob_item));
+}
+
+auto List::end() const -> Iterator {
+  return begin() + PyList_GET_SIZE(PYOBJ_REF(this));
+}
+
 }
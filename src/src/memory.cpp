@@ -0,0 +1,173 @@
+#include "internal.h"
+
+namespace poppy {
+
+namespace {
+
+// layout of memory exported by Buffer::FromMemory
+struct MemoryLayout {
+  void* data;
+  Py_ssize_t itemsize;
+  Py_ssize_t length;
+  std::string format;
+  std::vector<Py_ssize_t> shape;
+  std::vector<Py_ssize_t> strides;
+  std::function<void()> deleter;
+  bool readonly;
+  bool c_contiguous;
+  bool f_contiguous;
+};
+
+struct MemoryObject {
+  PyObject_HEAD
+  MemoryLayout* layout;
+};
+
+auto IsContiguous(const MemoryLayout& layout, const bool& fortran) -> bool {
+  auto expected = layout.itemsize;
+  auto ndim = static_cast<int>(layout.shape.size());
+  for (int i = 0; i < ndim; ++i) {
+    auto axis = fortran ? i : ndim - 1 - i;
+    if (layout.shape[axis] > 1 && layout.strides[axis] != expected) {
+      return false;
+    }
+    expected *= layout.shape[axis];
+  }
+  return true;
+}
+
+auto GetBuffer(PyObject* self, Py_buffer* view, int flags) -> int {
+  auto& layout = *reinterpret_cast<MemoryObject*>(self)->layout;
+  if ((flags & PyBUF_WRITABLE) && layout.readonly) {
+    PyErr_SetString(PyExc_BufferError, "buffer is read-only");
+    return -1;
+  }
+  auto requested = [flags](const int& request) {
+    return (flags & request) == request;
+  };
+  auto any_contiguous = layout.c_contiguous || layout.f_contiguous;
+  if ((requested(PyBUF_C_CONTIGUOUS) && !layout.c_contiguous) ||
+      (requested(PyBUF_F_CONTIGUOUS) && !layout.f_contiguous) ||
+      (requested(PyBUF_ANY_CONTIGUOUS) && !any_contiguous) ||
+      (!requested(PyBUF_STRIDES) && !layout.c_contiguous)) {
+    PyErr_SetString(PyExc_BufferError, "buffer is not contiguous");
+    return -1;
+  }
+  view->obj = self;
+  Py_INCREF(self);
+  view->buf = layout.data;
+  view->len = layout.length;
+  view->readonly = layout.readonly;
+  view->itemsize = layout.itemsize;
+  view->format = (flags & PyBUF_FORMAT)
+    ? const_cast<char*>(layout.format.c_str()) : nullptr;
+  view->ndim = static_cast<int>(layout.shape.size());
+  view->shape = (flags & PyBUF_ND) == PyBUF_ND ? layout.shape.data() : nullptr;
+  view->strides = (flags & PyBUF_STRIDES) == PyBUF_STRIDES ? layout.strides.data() : nullptr;
+  view->suboffsets = nullptr;
+  view->internal = nullptr;
+  return 0;
+}
+
+auto Deallocate(PyObject* self) -> void {
+  auto type = Py_TYPE(self);
+  auto layout = reinterpret_cast<MemoryObject*>(self)->layout;
+  if (layout->deleter) {
+    try {
+      layout->deleter();
+    }
+    catch (...) {
+      // exceptions must not cross the interpreter
+    }
+  }
+  delete layout;
+  type->tp_free(self);
+  Py_DECREF(type);
+}
+
+auto MemoryType() -> PyTypeObject* {
+  auto& memory_type = internal::CurrentState().memory_type;
+  if (!memory_type) {
+    static PyType_Slot slots[] = {
+      { Py_bf_getbuffer, reinterpret_cast<void*>(GetBuffer) },
+      { Py_tp_dealloc, reinterpret_cast<void*>(Deallocate) },
+      { 0, nullptr },
+    };
+    static PyType_Spec spec = {
+      "poppy.Memory",
+      sizeof(MemoryObject),
+      0,
+      Py_TPFLAGS_DEFAULT | Py_TPFLAGS_DISALLOW_INSTANTIATION,
+      slots,
+    };
+    memory_type = PyType_FromSpec(&spec);
+    if (!memory_type) {
+      PyErr_Print();
+      throw std::runtime_error("failed to create memory type");
+    }
+  }
+  return reinterpret_cast<PyTypeObject*>(memory_type);
+}
+
+}
+
+namespace internal {
+
+auto ClearMemoryType() -> void {
+  Py_CLEAR(CurrentState().memory_type);
+}
+
+}  // namespace internal
+
+auto Buffer::FromMemory(
+  void* data,
+  const size_t& itemsize,
+  const std::string& format,
+  const std::vector<size_t>& shape,
+  const std::vector<std::ptrdiff_t>& strides,
+  const std::function<void()>& deleter,
+  const bool& readonly) -> Buffer {
+  if (!strides.empty() && strides.size() != shape.size()) {
+    throw std::logic_error("shape and strides mismatch");
+  }
+  auto layout = new MemoryLayout{
+    data,
+    static_cast<Py_ssize_t>(itemsize),
+    static_cast<Py_ssize_t>(itemsize),
+    format,
+    std::vector<Py_ssize_t>(shape.begin(), shape.end()),
+    std::vector<Py_ssize_t>(shape.size()),
+    deleter,
+    readonly,
+    false,
+    false,
+  };
+  auto stride = layout->itemsize;
+  for (auto i = shape.size(); i-- > 0;) {
+    layout->strides[i] = strides.empty() ? stride : strides[i];
+    stride *= layout->shape[i];
+    layout->length *= layout->shape[i];
+  }
+  layout->c_contiguous = IsContiguous(*layout, false);
+  layout->f_contiguous = IsContiguous(*layout, true);
+
+  PyTypeObject* type = nullptr;
+  PyObject* obj = nullptr;
+  try {
+    type = MemoryType();
+    obj = type->tp_alloc(type, 0);
+  }
+  catch (...) {
+    delete layout;
+    throw;
+  }
+  if (!obj) {
+    delete layout;
+    PyErr_Print();
+    throw std::runtime_error("failed to create memory object");
+  }
+  reinterpret_cast<MemoryObject*>(obj)->layout = layout;
+  return Buffer(obj, StealTag());
+}
+
+}
@@ -0,0 +1,20 @@
+#include "poppy.h"
+#include <Python.h>
+
+namespace poppy {
+
+Name::Name(const std::string& name)
+  : Object(Init(name), StealTag()) {}
+
+auto Name::Init(const std::string& name) -> void* {
+  auto str = PyUnicode_InternFromString(name.c_str());
+  if (!str) {
+    PyErr_Print();
+    throw std::runtime_error("failed to create name");
+  }
+  // hash is cached in the object, so later lookups skip hashing
+  PyObject_Hash(str);
+  return str;
+}
+
+}
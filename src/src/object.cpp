@@ -1,53 +1,57 @@
-#include "poppy.h"
-#include <Python.h>
+#include "internal.h"
 
 namespace poppy {
 
-class ObjectImpl {
-public:
-  ObjectImpl(void* ptr)
-    : ptr_(reinterpret_cast<PyObject*>(ptr)) {
-    Py_INCREF(ptr_);
-  }
-  ObjectImpl(const ObjectImpl& obj)
-    : ptr_(obj.ptr_) {
-    Py_INCREF(ptr_);
-  }
-  ~ObjectImpl() {
-    Py_DECREF(ptr_);
+static_assert(sizeof(Object) == sizeof(void*), "Object must be a single pointer");
+
+auto internal::InternedName(const std::string& name) -> PyObject* {
+  auto& interned_names = CurrentState().names;
+  auto it = interned_names.find(name);
+  if (it != interned_names.end()) {
+    return it->second;
   }
-  auto operator=(const ObjectImpl& obj) -> ObjectImpl& {
-    ptr_ = obj.ptr_;
-    Py_INCREF(ptr_);
-    return *this;
+  auto str = PyUnicode_InternFromString(name.c_str());
+  if (str) {
+    interned_names.emplace(name, str);
   }
-  auto GetRef() const -> PyObject* {
-    return ptr_;
+  return str;
+}
+
+auto internal::ClearInternedNames() -> void {
+  auto& interned_names = CurrentState().names;
+  for (auto& kv : interned_names) {
+    Py_DECREF(kv.second);
   }
-private:
-  PyObject* ptr_;
-};
+  interned_names.clear();
+}
 
 Object::Object()
-  : ref_(new int(0)), 
-    pimpl_(new ObjectImpl(Py_None)) {}
+  : ptr_(Py_None) {
+  Py_INCREF(Py_None);
+}
 
-Object::Object(void* ptr)
-  : ref_(new int(0)), 
-    pimpl_(new ObjectImpl(ptr)) {}
+Object::Object(void* ptr, StealTag)
+  : ptr_(ptr) {}
+
+Object::Object(void* ptr, BorrowTag)
+  : ptr_(ptr) {
+  Py_INCREF(PYOBJ_REF(this));
+}
 
 Object::Object(const Object& obj)
-  : ref_(obj.ref_), 
-    pimpl_(obj.pimpl_) {
-  (*ref_)++;
+  : ptr_(obj.ptr_) {
+  Py_INCREF(PYOBJ_REF(this));
 }
 
+Object::Object(Object&& obj) noexcept
+  : ptr_(obj.Release()) {}
+
 auto Object::Load(const std::string& file_name) -> Object {
   auto name = PyUnicode_DecodeFSDefault(file_name.c_str());
   auto module = PyImport_Import(name);
   Py_DECREF(name);
   if (module) {
-    return Object(module);
+    return Object(module, StealTag());
   } else {
     PyErr_Print();
     throw std::runtime_error("Failed to load module");
@@ -55,23 +59,35 @@ auto Object::Load(const std::string& file_name) -> Object {
 }
 
 Object::~Object() {
-  if (*ref_ == 0) {
-    delete pimpl_;
-    pimpl_ = nullptr;
-    delete ref_;
-    ref_ = nullptr;
-  } else {
-    (*ref_)--;
+  // handles may outlive Finalize() (e.g. locals in main)
+  if (Py_IsInitialized()) {
+    Py_XDECREF(PYOBJ_REF(this));
   }
 }
 
 auto Object::operator=(const Object& obj) -> Object& {
-  pimpl_ = obj.pimpl_;
-  ref_ = obj.ref_;
-  (*ref_)++;
+  auto old = PYOBJ_REF(this);
+  ptr_ = obj.ptr_;
+  Py_INCREF(PYOBJ_REF(this));
+  Py_XDECREF(old);
+  return *this;
+}
+
+auto Object::operator=(Object&& obj) noexcept -> Object& {
+  if (this != &obj) {
+    auto old = PYOBJ_REF(this);
+    ptr_ = obj.Release();
+    Py_XDECREF(old);
+  }
   return *this;
 }
 
+auto Object::Release() -> void* {
+  auto ptr = ptr_;
+  ptr_ = nullptr;
+  return ptr;
+}
+
 auto Object::operator==(const Object& obj) const -> bool {
   return PyObject_RichCompareBool(PYOBJ_REF(this), PYOBJ_REF(&obj), Py_EQ);
 }
@@ -102,18 +118,18 @@ auto operator<<(std::ostream& out, const Object& obj) -> std::ostream& {
 }
 
 auto Object::None() -> Object {
-  return Object(Py_None);
+  return Object(Py_None, BorrowTag());
 }
 
 auto Object::GetRef() const -> void* {
-  return pimpl_->GetRef();
+  return ptr_;
 }
 
 auto Object::Type() const -> std::string {
   auto obj = PyObject_Type(PYOBJ_REF(this));
   auto type = PyObject_GetAttrString(obj, "__name__");
   Py_DECREF(obj);
-  auto str = PyUnicode_AsUTF8(type);
+  auto str = std::string(PyUnicode_AsUTF8(type));
   Py_DECREF(type);
   return str;
 }
@@ -124,25 +140,53 @@ auto Object::Hash() const -> size_t {
 
 auto Object::ToString() const -> std::string {
   auto repr = PyObject_Repr(PYOBJ_REF(this));
-  auto str = PyUnicode_AsUTF8(repr);
-  Py_XDECREF(repr);
+  auto str = std::string(PyUnicode_AsUTF8(repr));
+  Py_DECREF(repr);
   return str;
 }
 
 auto Object::IsNone() const -> bool {
-  return pimpl_->GetRef() == Py_None;
+  return ptr_ == Py_None;
 }
 
 auto Object::ContainsAttribute(const std::string& name) const -> bool {
   return PyObject_HasAttrString(PYOBJ_REF(this), name.c_str());
 }
 
+auto Object::ContainsAttribute(const Name& name) const -> bool {
+  return PyObject_HasAttr(PYOBJ_REF(this), PYOBJ_REF(&name));
+}
+
 auto Object::RemoveAttribute(const std::string& name) const -> bool {
-  return PyObject_DelAttrString(PYOBJ_REF(this), name.c_str());
+  if (PyObject_DelAttrString(PYOBJ_REF(this), name.c_str()) < 0) {
+    PyErr_Clear();
+    return false;
+  }
+  return true;
+}
+
+auto Object::RemoveAttribute(const Name& name) const -> bool {
+  if (PyObject_DelAttr(PYOBJ_REF(this), PYOBJ_REF(&name)) < 0) {
+    PyErr_Clear();
+    return false;
+  }
+  return true;
 }
 
 auto Object::SetAttribute(const std::string& name, const Object& obj) const -> bool {
-  return PyObject_SetAttrString(PYOBJ_REF(this), name.c_str(), PYOBJ_REF(&obj)) == 0;
+  if (PyObject_SetAttrString(PYOBJ_REF(this), name.c_str(), PYOBJ_REF(&obj)) < 0) {
+    PyErr_Clear();
+    return false;
+  }
+  return true;
+}
+
+auto Object::SetAttribute(const Name& name, const Object& obj) const -> bool {
+  if (PyObject_SetAttr(PYOBJ_REF(this), PYOBJ_REF(&name), PYOBJ_REF(&obj)) < 0) {
+    PyErr_Clear();
+    return false;
+  }
+  return true;
 }
 
 auto Object::SetAttributes(const Dict& dict) const -> bool {
@@ -150,11 +194,58 @@ auto Object::SetAttributes(const Dict& dict) const -> bool {
 }
 
 auto Object::GetAttribute(const std::string& name) const -> Generic {
-  return Generic(PyObject_GetAttrString(PYOBJ_REF(this), name.c_str()));
+  auto attr = PyObject_GetAttrString(PYOBJ_REF(this), name.c_str());
+  if (!attr) {
+    PyErr_Clear();
+    throw std::logic_error("not found");
+  }
+  return Generic(attr, StealTag());
+}
+
+auto Object::GetAttribute(const Name& name) const -> Generic {
+  auto attr = PyObject_GetAttr(PYOBJ_REF(this), PYOBJ_REF(&name));
+  if (!attr) {
+    PyErr_Clear();
+    throw std::logic_error("not found");
+  }
+  return Generic(attr, StealTag());
 }
 
 auto Object::GetAttributes() const -> Dict {
-  return Dict(PyObject_GenericGetDict(PYOBJ_REF(this), NULL));
+  auto dict = PyObject_GenericGetDict(PYOBJ_REF(this), NULL);
+  if (!dict) {
+    PyErr_Clear();
+    throw std::logic_error("not found");
+  }
+  return Dict(dict, StealTag());
+}
+
+auto Object::CallMethodVector(
+  const std::string& name,
+  void** args,
+  const size_t& size) const -> Generic {
+  auto str = internal::InternedName(name);
+  if (!str) {
+    PyErr_Print();
+    throw std::runtime_error("failed to run method");
+  }
+  return CallMethodVector(str, args, size);
+}
+
+auto Object::CallMethodVector(
+  void* name,
+  void** args,
+  const size_t& size) const -> Generic {
+  auto ret = PyObject_VectorcallMethod(
+    reinterpret_cast<PyObject*>(name),
+    reinterpret_cast<PyObject**>(args) + 1,
+    size | PY_VECTORCALL_ARGUMENTS_OFFSET,
+    NULL);
+  if (!ret) {
+    PyErr_Print();
+    throw std::runtime_error("failed to run method");
+  }
+  return Generic(ret, StealTag());
 }
 
 }
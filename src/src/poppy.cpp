@@ -1,11 +1,17 @@
-#include "poppy.h"
-#include <Python.h>
+#include "internal.h"
 
 namespace poppy {
 
+static size_t reload_generation = 0;
+
+auto internal::ReloadGeneration() -> size_t {
+  return reload_generation;
+}
+
 auto Initialize() -> void {
   if (!Py_IsInitialized()) {
     Py_Initialize();
+    internal::MarkGIL(true);
     AddModuleDirectory(".");
   }
 }
@@ -23,12 +29,17 @@ auto Initialize(
     PyWideStringList_Append(
       &config.module_search_paths, module_search_path.c_str());
     Py_InitializeFromConfig(&config);
+    internal::MarkGIL(true);
     PyConfig_Clear(&config);
   }
 }
 
 auto Finalize() -> void {
+  if (Py_IsInitialized()) {
+    internal::ClearState();
+  }
   Py_Finalize();
+  internal::MarkGIL(false);
 }
 
 auto AddModuleDirectory(const std::string& target_path) -> void {
@@ -41,4 +52,16 @@ auto AddModuleDirectory(const std::string& target_path) -> void {
   Py_DECREF(str);
 }
 
-}
\ No newline at end of file
+
+auto Reload(const Object& module) -> Object {
+  auto reloaded = PyImport_ReloadModule(PYOBJ_REF(&module));
+  if (!reloaded) {
+    PyErr_Print();
+    throw std::runtime_error("Failed to reload module");
+  }
+  reload_generation++;
+  Py_DECREF(reloaded);
+  return module;
+}
+
+}
@@ -0,0 +1,196 @@
+#include "internal.h"
+#include <algorithm>
+#include <mutex>
+
+namespace poppy {
+
+namespace {
+
+// submissions between load decays when rebalancing is manual
+const size_t load_window = 1 << 16;
+
+}
+
+class ShardedExecutorImpl {
+public:
+  explicit ShardedExecutorImpl(const ShardedExecutorConfig& config)
+    : config_(config),
+      since_(0),
+      pool_(config.pool) {
+    if (!config_.hash) {
+      config_.hash = std::hash<std::string>();
+    }
+    stats_.resize(pool_.Size(), ShardStats());
+  }
+  auto Size() const -> size_t {
+    return pool_.Size();
+  }
+  auto ShardOf(const std::string& key) const -> size_t {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return Route(key);
+  }
+  auto Stats() const -> std::vector<ShardStats> {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+  }
+  auto Rebalance() -> size_t {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return RebalanceLocked();
+  }
+  auto Enqueue(const std::string& key, std::function<void(Interpreter&)>&& task) -> void {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto shard = Route(key);
+    loads_[key]++;
+    auto& stats = stats_[shard];
+    stats.submitted++;
+    stats.depth++;
+    stats.max_depth = std::max(stats.max_depth, stats.depth);
+    pool_.Enqueue(shard, [this, shard, task = std::move(task)](Interpreter& interpreter) {
+      task(interpreter);
+      Done(shard);
+    });
+    if (config_.rebalance_interval) {
+      if (++since_ >= config_.rebalance_interval) {
+        RebalanceLocked();
+      }
+    } else if (++since_ >= load_window) {
+      DecayLoads();
+    }
+  }
+private:
+  auto Home(const std::string& key) const -> size_t {
+    return config_.hash(key) % pool_.Size();
+  }
+  auto Route(const std::string& key) const -> size_t {
+    auto it = routes_.find(key);
+    return it != routes_.end() ? it->second : Home(key);
+  }
+  auto Done(const size_t& shard) -> void {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stats_[shard].depth--;
+    stats_[shard].completed++;
+  }
+  // keep loads_ bounded for high-cardinality keys, favoring hot ones
+  auto DecayLoads() -> void {
+    since_ = 0;
+    for (auto it = loads_.begin(); it != loads_.end();) {
+      it->second /= 2;
+      it = it->second ? std::next(it) : loads_.erase(it);
+    }
+  }
+  auto RebalanceLocked() -> size_t {
+    since_ = 0;
+    auto shards = pool_.Size();
+    std::vector<size_t> load(shards, 0);
+    size_t total = 0;
+    for (const auto& kv : loads_) {
+      load[Route(kv.first)] += kv.second;
+      total += kv.second;
+    }
+    size_t moved = 0;
+    while (moved < config_.max_moves && shards > 1) {
+      auto busiest = std::max_element(load.begin(), load.end()) - load.begin();
+      auto idlest = std::min_element(load.begin(), load.end()) - load.begin();
+      if (load[busiest] <= config_.imbalance * total / shards) {
+        break;
+      }
+      // hottest key whose move still narrows the gap
+      const std::string* hot = nullptr;
+      size_t hot_load = 0;
+      for (const auto& kv : loads_) {
+        if (kv.second > hot_load &&
+            load[idlest] + kv.second < load[busiest] &&
+            Route(kv.first) == static_cast<size_t>(busiest)) {
+          hot = &kv.first;
+          hot_load = kv.second;
+        }
+      }
+      if (!hot) {
+        break;
+      }
+      Move(*hot, busiest, idlest);
+      load[busiest] -= hot_load;
+      load[idlest] += hot_load;
+      moved++;
+    }
+    loads_.clear();
+    return moved;
+  }
+  auto Move(const std::string& key, const size_t& from, const size_t& to) -> void {
+    auto hooks = config_.export_state && config_.import_state;
+    auto promise = std::make_shared<std::promise<std::string>>();
+    std::shared_future<std::string> state = promise->get_future();
+    // tasks already queued for the key run before the export, and tasks
+    // submitted from now on queue behind the import; the barrier keeps the
+    // order even without hooks
+    pool_.Enqueue(from, [this, key, promise, hooks](Interpreter& interpreter) {
+      try {
+        promise->set_value(hooks ? config_.export_state(interpreter, key) : std::string());
+      }
+      catch (...) {
+        promise->set_exception(std::current_exception());
+      }
+    });
+    pool_.Enqueue(to, [this, key, state, hooks](Interpreter& interpreter) {
+      {
+        // let the old shard run even when the GIL is shared
+        GILRelease release;
+        state.wait();
+      }
+      if (!hooks) {
+        return;
+      }
+      try {
+        config_.import_state(interpreter, key, state.get());
+      }
+      catch (...) {
+        // no caller to report to; the key starts with fresh state
+      }
+    });
+    if (to == Home(key)) {
+      routes_.erase(key);
+    } else {
+      routes_[key] = to;
+    }
+    stats_[to].keys_moved_in++;
+  }
+  ShardedExecutorConfig config_;
+  mutable std::mutex mutex_;
+  std::unordered_map<std::string, size_t> routes_;
+  std::unordered_map<std::string, size_t> loads_;
+  std::vector<ShardStats> stats_;
+  size_t since_;
+  // declared last so that workers stop before the members above go away
+  InterpreterPool pool_;
+};
+
+ShardedExecutor::ShardedExecutor(const ShardedExecutorConfig& config)
+  : pimpl_(new ShardedExecutorImpl(config)) {}
+
+ShardedExecutor::~ShardedExecutor() {
+  delete pimpl_;
+}
+
+auto ShardedExecutor::Size() const -> size_t {
+  return pimpl_->Size();
+}
+
+auto ShardedExecutor::ShardOf(const std::string& key) const -> size_t {
+  return pimpl_->ShardOf(key);
+}
+
+auto ShardedExecutor::Stats() const -> std::vector<ShardStats> {
+  return pimpl_->Stats();
+}
+
+auto ShardedExecutor::Rebalance() -> size_t {
+  return pimpl_->Rebalance();
+}
+
+auto ShardedExecutor::Enqueue(
+  const std::string& key,
+  std::function<void(Interpreter&)>&& task) -> void {
+  pimpl_->Enqueue(key, std::move(task));
+}
+
+}
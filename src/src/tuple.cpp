@@ -1,18 +1,17 @@
 #include "poppy.h"
 #include <Python.h>
+#include <cassert>
 
 namespace poppy {
 
-Tuple::Tuple(void* ptr)
-  : Object(ptr) {}
-
 Tuple::Tuple(const std::vector<Object>& initializer)
-  : Object(Init(initializer)) {}
+  : Object(Init(initializer), StealTag()) {}
 
 auto Tuple::Init(const std::vector<Object>& initializer) -> void* {
   auto tuple = PyTuple_New(initializer.size());
   int i = 0;
   for (const auto& item : initializer) {
+    Py_INCREF(PYOBJ_REF(&item));
     PyTuple_SetItem(tuple, i++, PYOBJ_REF(&item));
   }
   return tuple;
@@ -21,9 +20,10 @@ auto Tuple::Init(const std::vector<Object>& initializer) -> void* {
 auto Tuple::Get(const int& index) const -> Generic {
   auto obj = PyTuple_GetItem(PYOBJ_REF(this), index);
   if (!obj) {
+    PyErr_Clear();
     throw std::out_of_range("");
   }
-  return Generic(obj);
+  return Generic(obj, BorrowTag());
 }
 
 auto Tuple::Size() const -> size_t {
@@ -32,10 +32,25 @@ auto Tuple::Size() const -> size_t {
 
 auto Tuple::ToStdVector() const -> std::vector<Generic> {
   std::vector<Generic> v;
-  for (int i = 0; i < Size(); ++i) {
-    v.push_back(Get(i));
+  v.reserve(Size());
+  for (const auto& item : *this) {
+    v.push_back(item.ToGeneric());
   }
   return v;
 }
 
-}
\ No newline at end of file
+auto Tuple::operator[](const size_t& index) const -> ObjectView {
+  assert(index < static_cast<size_t>(PyTuple_GET_SIZE(PYOBJ_REF(this))));
+  return ObjectView(PyTuple_GET_ITEM(PYOBJ_REF(this), index));
+}
+
+auto Tuple::begin() const -> Iterator {
+  return Iterator(reinterpret_cast<void* const*>(
+    reinterpret_cast<PyTupleObject*>(PYOBJ_REF(this))->ob_item));
+}
+
+auto Tuple::end() const -> Iterator {
+  return begin() + PyTuple_GET_SIZE(PYOBJ_REF(this));
+}
+
+}
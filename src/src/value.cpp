@@ -1,17 +1,122 @@
-#include "poppy.h"
-#include <Python.h>
+#include "internal.h"
 
 namespace poppy {
 
-Value::Value(void* ptr)
-  : Object(ptr) {}
+namespace {
+
+// upper bound of cached integers, to keep EnableValueCache cheap
+const unsigned long max_cached_ints = 1 << 16;
+
+auto Cache() -> internal::ValueCache& {
+  return internal::CurrentState().values;
+}
+
+}
+
+auto EnableValueCache(const ValueCacheConfig& config) -> void {
+  if (config.int_min > config.int_max) {
+    throw std::out_of_range("");
+  }
+  // unsigned arithmetic, as the difference may exceed LONG_MAX
+  auto span = static_cast<unsigned long>(config.int_max) - static_cast<unsigned long>(config.int_min);
+  if (span >= max_cached_ints) {
+    throw std::out_of_range("");
+  }
+  DisableValueCache();
+  auto& cache = Cache();
+  cache.config = config;
+  cache.ints.reserve(span + 1);
+  for (unsigned long i = 0; i <= span; ++i) {
+    cache.ints.push_back(PyLong_FromLong(config.int_min + static_cast<long>(i)));
+  }
+  cache.index.reserve(config.string_capacity);
+  cache.enabled = true;
+}
+
+auto DisableValueCache() -> void {
+  if (!Py_IsInitialized()) {
+    return;
+  }
+  auto& cache = Cache();
+  for (auto obj : cache.ints) {
+    Py_DECREF(obj);
+  }
+  for (auto& entry : cache.strings) {
+    Py_DECREF(entry.second);
+  }
+  cache.ints.clear();
+  cache.index.clear();
+  cache.strings.clear();
+  cache.stats = ValueCacheStats();
+  cache.enabled = false;
+}
+
+auto GetValueCacheStats() -> ValueCacheStats {
+  auto stats = Cache().stats;
+  stats.string_entries = Cache().strings.size();
+  return stats;
+}
+
+namespace internal {
+
+auto CachedInt(const long long& value) -> PyObject* {
+  auto& cache = Cache();
+  if (!cache.enabled) {
+    return nullptr;
+  }
+  if (value < cache.config.int_min || value > cache.config.int_max) {
+    cache.stats.int_misses++;
+    return nullptr;
+  }
+  cache.stats.int_hits++;
+  auto obj = cache.ints[value - cache.config.int_min];
+  Py_INCREF(obj);
+  return obj;
+}
+
+auto CachedString(const char* value, const size_t& size) -> PyObject* {
+  auto& cache = Cache();
+  if (!cache.enabled) {
+    return nullptr;
+  }
+  if (size > cache.config.string_max_length || !cache.config.string_capacity) {
+    cache.stats.string_misses++;
+    return nullptr;
+  }
+  auto found = cache.index.find(std::string_view(value, size));
+  if (found != cache.index.end()) {
+    cache.stats.string_hits++;
+    cache.strings.splice(cache.strings.begin(), cache.strings, found->second);
+    Py_INCREF(found->second->second);
+    return found->second->second;
+  }
+  cache.stats.string_misses++;
+  auto obj = PyUnicode_FromStringAndSize(value, size);
+  if (!obj) {
+    PyErr_Clear();
+    return nullptr;
+  }
+  if (cache.strings.size() >= cache.config.string_capacity) {
+    auto& last = cache.strings.back();
+    cache.index.erase(last.first);
+    Py_DECREF(last.second);
+    cache.strings.pop_back();
+    cache.stats.string_evictions++;
+  }
+  cache.strings.emplace_front(std::string(value, size), obj);
+  cache.index.emplace(cache.strings.front().first, cache.strings.begin());
+  Py_INCREF(obj);
+  return obj;
+}
+
+}  // namespace internal
 
 auto Value::True() -> Value {
-  return Value(Py_True);
+  return Value(Py_True, BorrowTag());
 }
 
 auto Value::False() -> Value {
-  return Value(Py_False);
+  return Value(Py_False, BorrowTag());
 }
 
 auto Value::FromBool(const bool& value) -> Value {
@@ -19,19 +124,34 @@ auto Value::FromBool(const bool& value) -> Value {
 }
 
 auto Value::FromInt(const long& value) -> Value {
-  return Value(PyLong_FromLong(value));
+  if (auto obj = internal::CachedInt(value)) {
+    return Value(obj, StealTag());
+  }
+  return Value(PyLong_FromLong(value), StealTag());
 }
 
 auto Value::FromFloat(const double& value) -> Value {
-  return Value(PyFloat_FromDouble(value));
+  return Value(PyFloat_FromDouble(value), StealTag());
 }
 
 auto Value::FromString(const std::string& value) -> Value {
-  return Value(PyUnicode_FromString(value.c_str()));
+  return FromString(value.data(), value.size());
+}
+
+auto Value::FromString(const char* value, const size_t& size) -> Value {
+  if (auto obj = internal::CachedString(value, size)) {
+    return Value(obj, StealTag());
+  }
+  auto obj = PyUnicode_FromStringAndSize(value, size);
+  if (!obj) {
+    PyErr_Clear();
+    throw std::bad_cast();
+  }
+  return Value(obj, StealTag());
 }
 
 auto Value::FromBytes(const char* value, const size_t& size) -> Value {
-  return Value(PyBytes_FromStringAndSize(value, size));
+  return Value(PyBytes_FromStringAndSize(value, size), StealTag());
 }
 
 auto Value::FromBytes(const std::vector<char>& buf) -> Value {
@@ -39,11 +159,11 @@ auto Value::FromBytes(const std::vector<char>& buf) -> Value {
 }
 
 auto Value::FromByteArray(const char* value, const size_t& size) -> Value {
-  return Value(PyByteArray_FromStringAndSize(value, size));
+  return Value(PyByteArray_FromStringAndSize(value, size), StealTag());
 }
 
 auto Value::FromByteArray(const std::vector<char>& buf) -> Value {
-  return Value::FromBytes(buf.data(), buf.size());
+  return Value::FromByteArray(buf.data(), buf.size());
 }
 
 auto Value::IsTrue() const -> bool {
@@ -80,7 +200,7 @@ auto Value::IsByteArray() const -> bool {
 
 auto Value::ToBool() const -> bool {
   if (IsBool()) {
-    return PyBool_FromLong(ToInt());
+    return IsTrue();
   } else {
     throw std::bad_cast();
   }
@@ -105,11 +225,7 @@ auto Value::ToFloat() const -> double {
 }
 
 auto Value::ToString() const -> std::string {
-  if (IsString()) {
-    return std::string(PyUnicode_AsUTF8(PYOBJ_REF(this)));
-  } else {
-    throw std::bad_cast();
-  }
+  return std::string(ToStringView());
 }
 
 auto Value::ToBytes() const -> std::vector<char> {
@@ -132,4 +248,36 @@ auto Value::ToByteArray() const -> std::vector<char> {
   }
 }
 
-}
\ No newline at end of file
+auto Value::ToStringView() const -> std::string_view {
+  if (IsString()) {
+    Py_ssize_t size = 0;
+    auto ptr = PyUnicode_AsUTF8AndSize(PYOBJ_REF(this), &size);
+    if (!ptr) {
+      PyErr_Clear();
+      throw std::bad_cast();
+    }
+    return std::string_view(ptr, size);
+  } else {
+    throw std::bad_cast();
+  }
+}
+
+auto Value::ToBytesView() const -> Span<const char> {
+  if (IsBytes()) {
+    return Span<const char>(
+      PyBytes_AS_STRING(PYOBJ_REF(this)), PyBytes_GET_SIZE(PYOBJ_REF(this)));
+  } else {
+    throw std::bad_cast();
+  }
+}
+
+auto Value::ToByteArrayView() const -> Span<char> {
+  if (IsByteArray()) {
+    return Span<char>(
+      PyByteArray_AS_STRING(PYOBJ_REF(this)), PyByteArray_GET_SIZE(PYOBJ_REF(this)));
+  } else {
+    throw std::bad_cast();
+  }
+}
+
+}
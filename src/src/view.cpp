@@ -0,0 +1,14 @@
+#include "poppy.h"
+#include <Python.h>
+
+namespace poppy {
+
+auto ObjectView::Type() const -> std::string {
+  return ToGeneric().Type();
+}
+
+auto ObjectView::ToGeneric() const -> Generic {
+  return Generic(ptr_, Generic::BorrowTag());
+}
+
+}
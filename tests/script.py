@@ -1,9 +1,16 @@
+import threading
 import time
 import numpy as np
 
 def echo(obj):
   return obj
 
+def echo_args(*args):
+  return args
+
+def echo_kwargs(a, b=None, *, c=None):
+  return a, b, c
+
 def echo_fail(obj):
   raise Exception("panic!")
 
@@ -25,3 +32,34 @@ def make_dict():
 def heavy_task(obj):
   time.sleep(0.1)
   return obj
+
+class Counter:
+  def __init__(self):
+    self.count = 0
+
+  def add(self, a=1, b=0):
+    self.count += a + b
+    return self.count
+
+def describe_buffer(obj):
+  view = memoryview(obj)
+  return view.format, view.itemsize, view.shape, view.strides, view.readonly
+
+def sum_buffer(obj):
+  return float(np.asarray(obj).sum())
+
+def scale_buffer(obj, factor):
+  array = np.asarray(obj)
+  array *= factor
+
+def make_matrix():
+  return np.arange(12, dtype=np.float64).reshape(3, 4)
+
+def make_int_matrix():
+  return np.arange(12, dtype=np.int64).reshape(3, 4)
+
+_local = threading.local()
+
+def local_counter():
+  _local.count = getattr(_local, "count", 0) + 1
+  return _local.count
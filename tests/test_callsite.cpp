@@ -0,0 +1,136 @@
+#include "test_root.h"
+#include <thread>
+
+TEST_F(Test, CallSite) {
+  auto func = module_.GetAttribute("echo_args").ToFunc();
+  auto site = CallSite(func, 5);
+  EXPECT_EQ(5, site.Arity());
+
+  auto ret = site().ToTuple();
+  EXPECT_EQ(5, ret.Size());
+  EXPECT_TRUE(ret.Get(0).IsNone());
+
+  site
+    .SetBool(0, true)
+    .SetInt(1, -3)
+    .SetFloat(2, 0.25)
+    .SetString(3, "hello")
+    .Set(4, List(Int(1), Int(2)));
+  for (int i = 0; i < 3; ++i) {
+    ret = site.Invoke().ToTuple();
+    EXPECT_TRUE(ret.Get(0).ToValue().IsTrue());
+    EXPECT_EQ(-3, ret.Get(1).ToValue().ToInt());
+    EXPECT_FLOAT_EQ(0.25, ret.Get(2).ToValue().ToFloat());
+    EXPECT_STREQ("hello", ret.Get(3).ToValue().ToString().c_str());
+    EXPECT_EQ(2, ret.Get(4).ToList().Size());
+  }
+
+  site.SetInt(1, 7);
+  EXPECT_EQ(7, site().ToTuple().Get(1).ToValue().ToInt());
+
+  auto moved = std::move(site);
+  EXPECT_EQ(5, moved.Arity());
+  EXPECT_EQ(7, moved().ToTuple().Get(1).ToValue().ToInt());
+
+  // builtin functions implement vectorcall too
+  auto len = Import("builtins").GetAttribute("len").ToFunc();
+  auto site_len = CallSite(len, 1);
+  EXPECT_EQ(3, site_len.SetString(0, "abc").Invoke().ToValue().ToInt());
+}
+
+TEST_F(Test, CallSiteAbnormal) {
+  auto site = CallSite(module_.GetAttribute("echo_fail").ToFunc(), 1);
+
+  try {
+    site.SetInt(1, 0);
+    FAIL();
+  }
+  catch (std::out_of_range& e) {
+    EXPECT_STREQ("", e.what());
+  }
+
+  // invalid utf-8 leaves the previous argument bound
+  auto echo = CallSite(module_.GetAttribute("echo").ToFunc(), 1);
+  echo.SetString(0, "ok");
+  EXPECT_THROW(echo.SetString(0, "\xff"), std::bad_cast);
+  EXPECT_EQ("ok", echo.Invoke().ToValue().ToString());
+
+  try {
+    site.Invoke();
+    FAIL();
+  }
+  catch (std::runtime_error& e) {
+    EXPECT_STREQ("failed to run function", e.what());
+  }
+}
+
+TEST_F(Test, Map) {
+  auto echo = module_.GetAttribute("echo").ToFunc();
+  std::vector<double> inputs { 0.5, 1.5, -2 };
+  std::vector<double> outputs;
+  echo.Map(inputs, outputs);
+  EXPECT_EQ(inputs, outputs);
+
+  std::vector<Generic> results;
+  echo.Map(std::vector<std::string>{ "a", "b" }, results);
+  EXPECT_EQ(2, results.size());
+  EXPECT_STREQ("b", results[1].ToValue().ToString().c_str());
+
+  std::vector<bool> flags;
+  echo.Map(std::vector<bool>{ true, false }, flags);
+  EXPECT_EQ((std::vector<bool>{ true, false }), flags);
+
+  auto func = module_.GetAttribute("echo_args").ToFunc();
+  std::vector<std::tuple<int, double, std::string, Value>> args {
+    std::make_tuple(1, 0.5, "x", Int(10)),
+    std::make_tuple(2, 1.5, "y", Int(20)),
+  };
+  func.Map(args, results);
+  EXPECT_EQ(2, results.size());
+  auto t = results[1].ToTuple();
+  EXPECT_EQ(2, t.Get(0).ToValue().ToInt());
+  EXPECT_FLOAT_EQ(1.5, t.Get(1).ToValue().ToFloat());
+  EXPECT_STREQ("y", t.Get(2).ToValue().ToString().c_str());
+  EXPECT_EQ(20, t.Get(3).ToValue().ToInt());
+
+  std::vector<long> empty;
+  echo.Map(std::vector<long>(), empty);
+  EXPECT_TRUE(empty.empty());
+}
+
+TEST_F(Test, MapThread) {
+  auto echo = module_.GetAttribute("echo").ToFunc();
+  std::vector<long> inputs(1000);
+  for (size_t i = 0; i < inputs.size(); ++i) {
+    inputs[i] = i;
+  }
+  std::vector<long> outputs;
+  GILContext context;
+  std::thread th([&echo, &inputs, &outputs]() {
+    echo.Map(inputs, outputs);
+  });
+  th.join();
+  context.Release();
+  EXPECT_EQ(inputs, outputs);
+}
+
+TEST_F(Test, MapAbnormal) {
+  auto echo = module_.GetAttribute("echo").ToFunc();
+  std::vector<std::string> outputs;
+  try {
+    echo.Map(std::vector<long>{ 1 }, outputs);
+    FAIL();
+  }
+  catch (std::bad_cast& e) {
+    EXPECT_STREQ(BAD_CAST, e.what());
+  }
+
+  auto fail = module_.GetAttribute("echo_fail").ToFunc();
+  try {
+    fail.Map(std::vector<long>{ 1 }, outputs);
+    FAIL();
+  }
+  catch (std::runtime_error& e) {
+    EXPECT_STREQ("failed to run function", e.what());
+  }
+}
@@ -137,3 +137,101 @@ TEST_F(Test, DictAbnormal) {
     FAIL();
   }
 }
+
+TEST_F(Test, DictTryGet) {
+  auto t0 = Dict();
+  t0.Set("key1", Int(1));
+  t0.Set(Int(2), Str("two"));
+
+  auto t1 = t0.TryGet("key1");
+  ASSERT_TRUE(t1.has_value());
+  EXPECT_EQ(1, t1->ToValue().ToInt());
+  auto t2 = t0.TryGet(Int(2));
+  ASSERT_TRUE(t2.has_value());
+  EXPECT_EQ("two", t2->ToValue().ToString());
+  EXPECT_FALSE(t0.TryGet("?").has_value());
+  EXPECT_FALSE(t0.TryGet(Int(3)).has_value());
+
+  // unhashable key is reported as a missing key
+  EXPECT_FALSE(t0.TryGet(List()).has_value());
+  EXPECT_FALSE(t0.Contains(List()));
+}
+
+TEST_F(Test, DictPointerKey) {
+  const char buffer[] = "key1key2";
+  auto t0 = Dict();
+  t0.Set("key1", Int(1));
+  t0.Set("key2", Int(2));
+
+  EXPECT_TRUE(t0.Contains(buffer, 4));
+  EXPECT_TRUE(t0.Contains(buffer + 4, 4));
+  EXPECT_FALSE(t0.Contains(buffer, 8));
+  EXPECT_EQ(1, t0.Get(buffer, 4).ToValue().ToInt());
+  EXPECT_EQ(2, t0.TryGet(buffer + 4, 4)->ToValue().ToInt());
+
+  t0.Delete(buffer + 4, 4);
+  EXPECT_FALSE(t0.Contains("key2"));
+  EXPECT_EQ(1, t0.Size());
+
+  try {
+    t0.Delete(buffer + 4, 4);
+    FAIL();
+  }
+  catch (std::logic_error& e) {
+    EXPECT_STREQ("not found", e.what());
+  }
+  catch (...) {
+    FAIL();
+  }
+
+  try {
+    t0.Get("\xff", 1);
+    FAIL();
+  }
+  catch (std::runtime_error& e) {
+    EXPECT_STREQ("failed to decode key", e.what());
+  }
+  catch (...) {
+    FAIL();
+  }
+}
+
+TEST_F(Test, DictIterator) {
+  auto t0 = Dict();
+  t0.Set("key0", Int(0));
+  t0.Set("key1", Int(1));
+  t0.Set(Int(2), Str("value2"));
+
+  int i = 0;
+  for (const auto& kv : t0) {
+    switch (i++) {
+      case 0:
+        EXPECT_EQ("str", kv.first.Type());
+        EXPECT_STREQ("key0", kv.first.ToGeneric().ToValue().ToString().c_str());
+        EXPECT_EQ(0, kv.second.ToGeneric().ToValue().ToInt());
+        break;
+      case 1:
+        EXPECT_STREQ("key1", kv.first.ToGeneric().ToValue().ToString().c_str());
+        EXPECT_EQ(1, kv.second.ToGeneric().ToValue().ToInt());
+        break;
+      case 2:
+        EXPECT_EQ("int", kv.first.Type());
+        EXPECT_EQ(2, kv.first.ToGeneric().ToValue().ToInt());
+        EXPECT_STREQ("value2", kv.second.ToGeneric().ToValue().ToString().c_str());
+        break;
+    }
+  }
+  EXPECT_EQ(3, i);
+
+  auto it = t0.begin();
+  EXPECT_TRUE(it != t0.end());
+  EXPECT_EQ(t0.Get("key0").GetRef(), it->second.GetRef());
+  auto prev = it++;
+  EXPECT_EQ(t0.Get("key0").GetRef(), prev->second.GetRef());
+  EXPECT_EQ(t0.Get("key1").GetRef(), it->second.GetRef());
+  EXPECT_EQ(3, std::distance(t0.begin(), t0.end()));
+
+  auto t1 = Dict();
+  EXPECT_TRUE(t1.begin() == t1.end());
+  EXPECT_TRUE(t1.ToStdVector().empty());
+}
@@ -10,6 +10,59 @@ TEST_F(Test, Echo) {
   EXPECT_FLOAT_EQ(12.5, ret.Get(2).ToValue().ToFloat());
 }
 
+TEST_F(Test, EchoArgs) {
+  auto module = Import("script");
+  const auto func = module.GetAttribute("echo_args").ToFunc();
+  EXPECT_EQ(0, func().ToTuple().Size());
+  auto ret = func(Int(0), Str("hello"), Float(12.5), Int(3), Int(4), Int(5), Int(6), Int(7)).ToTuple();
+  EXPECT_EQ(8, ret.Size());
+  EXPECT_EQ(0, ret.Get(0).ToValue().ToInt());
+  EXPECT_STREQ("hello", ret.Get(1).ToValue().ToString().c_str());
+  EXPECT_FLOAT_EQ(12.5, ret.Get(2).ToValue().ToFloat());
+  EXPECT_EQ(7, ret.Get(7).ToValue().ToInt());
+  ret = func.Invoke(Int(0), Int(1)).ToTuple();
+  EXPECT_EQ(2, ret.Size());
+  EXPECT_EQ(1, ret.Get(1).ToValue().ToInt());
+}
+
+TEST_F(Test, EchoKeywords) {
+  auto func = module_.GetAttribute("echo_kwargs").ToFunc();
+  const auto keywords = Keywords("c", "b");
+  EXPECT_EQ(2, keywords.Size());
+  auto ret = func.InvokeWithKeywords(keywords, Int(0), Str("c"), Str("b")).ToTuple();
+  EXPECT_EQ(0, ret.Get(0).ToValue().ToInt());
+  EXPECT_STREQ("b", ret.Get(1).ToValue().ToString().c_str());
+  EXPECT_STREQ("c", ret.Get(2).ToValue().ToString().c_str());
+
+  ret = func.InvokeWithKeywords(Keywords("c"), Int(1), Int(2), Int(3)).ToTuple();
+  EXPECT_EQ(1, ret.Get(0).ToValue().ToInt());
+  EXPECT_EQ(2, ret.Get(1).ToValue().ToInt());
+  EXPECT_EQ(3, ret.Get(2).ToValue().ToInt());
+
+  ret = func.InvokeWithKeywords(Keywords(std::vector<std::string>()), Int(1)).ToTuple();
+  EXPECT_EQ(1, ret.Get(0).ToValue().ToInt());
+  EXPECT_TRUE(ret.Get(2).IsNone());
+}
+
+TEST_F(Test, EchoKeywordsAbnormal) {
+  auto func = module_.GetAttribute("echo_kwargs").ToFunc();
+  try {
+    func.InvokeWithKeywords(Keywords("a", "b"), Int(0));
+    FAIL();
+  }
+  catch (std::logic_error& e) {
+    EXPECT_STREQ("too few arguments for keywords", e.what());
+  }
+
+  try {
+    func.InvokeWithKeywords(Keywords("d"), Int(0), Int(1));
+    FAIL();
+  }
+  catch (std::runtime_error& e) {
+    EXPECT_STREQ("failed to run function", e.what());
+  }
+}
+
 TEST_F(Test, EchoAbnormal) {
   auto args = Tuple(Int(0), Str("hello"), Float(12.5));
   auto module = Import("script");
@@ -0,0 +1,178 @@
+#include "test_root.h"
+#include <cstdlib>
+#include <fstream>
+
+// leak check mode: set POPPY_LEAK_ITERATIONS to soak each API longer
+static auto Iterations() -> int {
+  auto env = std::getenv("POPPY_LEAK_ITERATIONS");
+  return env ? std::atoi(env) : 10000;
+}
+
+// sys.gettotalrefcount() exists only in debug builds of Python
+static auto TotalRefCount() -> long {
+  auto sys = Import("sys");
+  if (!sys.ContainsAttribute("gettotalrefcount")) {
+    return 0;
+  }
+  return sys.GetAttribute("gettotalrefcount").ToFunc()().ToValue().ToInt();
+}
+
+static auto ResidentKiB() -> long {
+  long pages = 0, resident = 0;
+  std::ifstream statm("/proc/self/statm");
+  if (statm >> pages >> resident) {
+    return resident * 4;
+  }
+  return 0;
+}
+
+static auto ExpectFlat(const Object& probe, const std::function<void(void)>& api) -> void {
+  for (int i = 0; i < 100; ++i) {
+    api();
+  }
+  auto refcount = RefCount(probe);
+  auto total = TotalRefCount();
+  auto resident = ResidentKiB();
+  for (int i = 0; i < Iterations(); ++i) {
+    api();
+  }
+  EXPECT_EQ(refcount, RefCount(probe));
+  EXPECT_GE(total + 100, TotalRefCount());
+  EXPECT_GE(resident + 8 * 1024, ResidentKiB());
+}
+
+TEST_F(Test, LeakObject) {
+  auto echo = module_.GetAttribute("echo").ToFunc();
+  ExpectFlat(echo, [this]() { module_.GetAttribute("echo"); });
+  ExpectFlat(echo, [this]() { module_.GetAttribute("echo").ToFunc(); });
+  ExpectFlat(module_, [this]() { module_.GetAttributes(); });
+  ExpectFlat(module_, [this]() { module_.Type(); });
+  ExpectFlat(module_, [this]() { module_.ToString(); });
+  ExpectFlat(module_, []() { Import("script"); });
+  ExpectFlat(module_, []() { Object::None(); });
+  auto text = Str("a,b,c");
+  ExpectFlat(text, [&text]() { text.CallMethod("split", Str(",")); });
+  ExpectFlat(text, [&text]() { text.CallMethod("upper"); });
+}
+
+TEST_F(Test, LeakValue) {
+  auto text = std::string(4096, 'x');
+  auto probe = Value::True();
+  ExpectFlat(probe, []() { Value::FromInt(1'000'000'000L).ToInt(); });
+  ExpectFlat(probe, []() { Value::FromFloat(0.5).ToFloat(); });
+  ExpectFlat(probe, [&text]() { Value::FromString(text).ToString(); });
+  ExpectFlat(probe, [&text]() { Value::FromBytes(text.c_str(), text.size()).ToBytes(); });
+  ExpectFlat(probe, [&text]() { Value::FromByteArray(text.c_str(), text.size()).ToByteArray(); });
+  ExpectFlat(probe, [&text]() { Value::FromString(text.data(), text.size()).ToStringView(); });
+  ExpectFlat(probe, [&text]() { Value::FromBytes(text.c_str(), text.size()).ToBytesView(); });
+  ExpectFlat(probe, [&probe]() { probe.ToBool(); });
+  ExpectFlat(probe, []() { Value::FromBool(true); });
+}
+
+TEST_F(Test, LeakFunc) {
+  auto echo = module_.GetAttribute("echo").ToFunc();
+  auto make_empty = module_.GetAttribute("make_empty").ToFunc();
+  auto probe = Float(12345.5);
+  ExpectFlat(probe, [&echo, &probe]() { echo(probe); });
+  ExpectFlat(probe, [&echo, &probe]() { echo.Invoke(probe).ToValue(); });
+  ExpectFlat(probe, [&echo, &probe]() { echo(Tuple(probe, probe)).ToTuple(); });
+  ExpectFlat(probe, [&echo, &probe]() { echo.InvokeWithKeywords(Keywords("obj"), probe); });
+  ExpectFlat(make_empty, [&make_empty]() { make_empty(); });
+  auto site = CallSite(echo, 1);
+  ExpectFlat(probe, [&site, &probe]() { site.Set(0, probe).Invoke(); });
+  ExpectFlat(probe, [&site]() { site.SetFloat(0, 0.5).Invoke(); });
+  ExpectFlat(echo, [&echo]() { CallSite(echo, 2); });
+  ExpectFlat(probe, [&echo, &probe]() { echo.Typed<Generic(Value)>()(probe); });
+  ExpectFlat(probe, [&echo, &probe]() {
+    echo.Typed<std::tuple<double, Generic>(Tuple)>()(Tuple(probe, probe));
+  });
+  ExpectFlat(echo, [&echo]() {
+    using Nested = std::vector<std::map<std::string, std::optional<double>>>;
+    echo.Typed<Nested(Nested)>()({ { { "a", 0.5 }, { "b", std::nullopt } } });
+  });
+  ExpectFlat(echo, [&echo]() {
+    try {
+      echo.Typed<long(std::string)>()("abc");
+    }
+    catch (std::bad_cast&) {
+    }
+  });
+}
+
+TEST_F(Test, LeakContainer) {
+  auto probe = Float(12345.5);
+  auto key = Str("key");
+  ExpectFlat(probe, [&probe]() { Tuple(probe, probe).Get(0); });
+  ExpectFlat(probe, [&probe]() { Tuple(probe, probe).ToStdVector(); });
+  ExpectFlat(probe, [&probe]() { List(probe, probe).Get(1); });
+  ExpectFlat(probe, [&probe]() { List(probe, probe).ToTuple(); });
+  ExpectFlat(probe, [&probe]() { List(probe, probe).ToStdVector(); });
+  ExpectFlat(probe, [&probe]() {
+    auto list = List(probe, probe);
+    for (const auto& item : list) {
+      item.ToGeneric();
+    }
+    list[1].ToGeneric();
+  });
+  ExpectFlat(probe, [&probe]() {
+    auto list = List();
+    list.Append(probe);
+    list.Insert(0, probe);
+    list.Set(1, probe);
+  });
+  ExpectFlat(probe, [&probe, &key]() {
+    auto dict = Dict();
+    dict.Set(key, probe);
+    dict.Set("str", probe);
+    dict.Get(key);
+    dict.Get("str");
+    dict.TryGet(key);
+    dict.TryGet("str", 3);
+    dict.Contains("?", 1);
+    for (const auto& kv : dict) {
+      kv.second.ToGeneric();
+    }
+    dict.GetKeys();
+    dict.GetValues();
+    dict.ToStdVector();
+    dict.Delete("str");
+  });
+  ExpectFlat(key, [&probe, &key]() {
+    Dict(std::unordered_map<Object, Object>{ { key, probe } }).Contains(key);
+  });
+}
+
+TEST_F(Test, LeakValueCache) {
+  ValueCacheConfig config;
+  config.string_capacity = 16;
+  EnableValueCache(config);
+  auto probe = Str("probe");
+  ExpectFlat(probe, []() { Int(7); });
+  ExpectFlat(probe, []() { Str("probe"); });
+  auto keys = std::vector<std::string>();
+  for (int i = 0; i < 64; ++i) {
+    keys.push_back("key" + std::to_string(i));
+  }
+  ExpectFlat(probe, [&keys]() {
+    for (const auto& key : keys) {
+      Str(key);
+    }
+  });
+  // evicted strings are released by the cache
+  auto evicted = Str("evicted entry");
+  auto base = RefCount(evicted);
+  for (const auto& key : keys) {
+    Str(key);
+  }
+  EXPECT_EQ(base - 1, RefCount(evicted));
+  DisableValueCache();
+}
+
+TEST_F(Test, LeakBuffer) {
+  auto buf = module_.GetAttribute("make_buffer").ToFunc()();
+  ExpectFlat(buf, [&buf]() { buf.ToBuffer().Data(); });
+  ExpectFlat(buf, [&buf]() {
+    auto copied = buf.ToBuffer();
+    copied = buf.ToBuffer();
+  });
+}
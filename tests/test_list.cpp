@@ -97,3 +97,76 @@ TEST_F(Test, ListAbnormal) {
     FAIL();
   }
 }
+
+TEST_F(Test, ListIterator) {
+  auto t0 = List(Int(0), Int(1), Str("two"), Float(0.5));
+  EXPECT_EQ(4, t0.end() - t0.begin());
+  EXPECT_EQ("str", t0[2].Type());
+  EXPECT_EQ(t0.Get(3).GetRef(), t0[3].GetRef());
+
+  int i = 0;
+  for (const auto& item : t0) {
+    EXPECT_EQ(t0.Get(i++).GetRef(), item.GetRef());
+  }
+  EXPECT_EQ(4, i);
+
+  auto it = t0.begin();
+  EXPECT_EQ(1, (*++it).ToGeneric().ToValue().ToInt());
+  EXPECT_EQ(1, (*it++).ToGeneric().ToValue().ToInt());
+  EXPECT_EQ("two", (*it).ToGeneric().ToValue().ToString());
+  EXPECT_FLOAT_EQ(0.5, it[1].ToGeneric().ToValue().ToFloat());
+  it += 2;
+  EXPECT_TRUE(it == t0.end());
+  EXPECT_TRUE(t0.begin() < it);
+  EXPECT_EQ(0, (*(it - 4)).ToGeneric().ToValue().ToInt());
+  EXPECT_EQ(0, (*(--it - 3)).ToGeneric().ToValue().ToInt());
+
+  auto t1 = List();
+  EXPECT_TRUE(t1.begin() == t1.end());
+  EXPECT_TRUE(t1.ToStdVector().empty());
+}
+
+TEST_F(Test, ListToVector) {
+  auto t0 = List::From(std::vector<double>{ 0.5, -1.25, 3.0 });
+  EXPECT_EQ(3, t0.Size());
+  EXPECT_EQ("float", t0.Get(0).Type());
+  EXPECT_EQ((std::vector<double>{ 0.5, -1.25, 3.0 }), t0.ToVector<double>());
+  EXPECT_EQ((std::vector<float>{ 0.5f, -1.25f, 3.0f }), t0.ToVector<float>());
+
+  auto t1 = List::From(std::vector<long>{ 1, -2, 3 });
+  EXPECT_EQ((std::vector<long>{ 1, -2, 3 }), t1.ToVector<long>());
+  EXPECT_EQ((std::vector<int>{ 1, -2, 3 }), t1.ToVector<int>());
+  // ints are accepted as floats
+  EXPECT_EQ((std::vector<double>{ 1, -2, 3 }), t1.ToVector<double>());
+
+  auto t2 = List::From(std::vector<bool>{ true, false });
+  EXPECT_TRUE(t2.Get(0).ToValue().IsTrue());
+  EXPECT_EQ((std::vector<bool>{ true, false }), t2.ToVector<bool>());
+
+  auto t3 = List::From(std::vector<std::string>{ "a", "", std::string("b\0c", 3) });
+  EXPECT_EQ((std::vector<std::string>{ "a", "", std::string("b\0c", 3) }),
+    t3.ToVector<std::string>());
+
+  auto t4 = List::From(std::vector<unsigned long long>{ 18446744073709551615ull });
+  EXPECT_EQ(18446744073709551615ull, t4.ToVector<unsigned long long>()[0]);
+
+  // mixed element types fall back to checked conversion
+  auto t5 = List(Float(0.5), Int(2), Float(1.5));
+  EXPECT_EQ((std::vector<double>{ 0.5, 2.0, 1.5 }), t5.ToVector<double>());
+
+  // any type supported by FromPython and ToPython
+  auto t6 = List::From(std::vector<std::vector<long>>{ { 1 }, { 2, 3 } });
+  EXPECT_EQ((std::vector<std::vector<long>>{ { 1 }, { 2, 3 } }), t6.ToVector<std::vector<long>>());
+
+  EXPECT_TRUE(List().ToVector<double>().empty());
+}
+
+TEST_F(Test, ListToVectorAbnormal) {
+  EXPECT_THROW(List(Int(1), Str("2")).ToVector<long>(), std::bad_cast);
+  EXPECT_THROW(List(Float(0.5)).ToVector<long>(), std::bad_cast);
+  EXPECT_THROW(List(Int(1)).ToVector<bool>(), std::bad_cast);
+  EXPECT_THROW(List(Int(1)).ToVector<std::string>(), std::bad_cast);
+  EXPECT_THROW(List(Int(-1)).ToVector<unsigned int>(), std::bad_cast);
+  EXPECT_THROW(List(Int(1L << 40)).ToVector<int>(), std::bad_cast);
+  EXPECT_THROW(List::From(std::vector<std::string>{ "\xff" }), std::bad_cast);
+}
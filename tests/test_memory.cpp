@@ -0,0 +1,111 @@
+#include "test_root.h"
+
+TEST_F(Test, MemoryExport) {
+  auto describe = module_.GetAttribute("describe_buffer").ToFunc();
+  auto sum = module_.GetAttribute("sum_buffer").ToFunc();
+  auto scale = module_.GetAttribute("scale_buffer").ToFunc();
+
+  std::vector<double> values = { 1, 2, 3, 4, 5, 6 };
+  auto t0 = Buffer::FromMemory(values.data(), { 2, 3 });
+  auto [format, itemsize, shape, strides, readonly] = describe.Typed<
+    std::tuple<std::string, long, std::vector<long>, std::vector<long>, bool>(Buffer)>()(t0);
+  EXPECT_EQ("d", format);
+  EXPECT_EQ(8, itemsize);
+  EXPECT_EQ((std::vector<long>{ 2, 3 }), shape);
+  EXPECT_EQ((std::vector<long>{ 24, 8 }), strides);
+  EXPECT_FALSE(readonly);
+  EXPECT_EQ(values.data(), t0.Data());
+  EXPECT_EQ(48, t0.Length());
+  EXPECT_DOUBLE_EQ(21, sum(t0).ToValue().ToFloat());
+
+  // writes from Python land in C++ memory
+  scale(t0, Int(2));
+  EXPECT_DOUBLE_EQ(12, values[5]);
+
+  // transposed view through explicit strides
+  auto t1 = Buffer::FromMemory(values.data(), { 3, 2 }, { 8, 24 });
+  EXPECT_EQ((std::vector<size_t>{ 8, 24 }), t1.Strides());
+  EXPECT_DOUBLE_EQ(42, sum(t1).ToValue().ToFloat());
+
+  const std::vector<int> ints = { 1, 2, 3 };
+  auto t2 = Buffer::FromMemory(ints.data(), { 3 });
+  EXPECT_EQ("i", t2.Format());
+  EXPECT_TRUE(std::get<4>(describe.Typed<
+    std::tuple<std::string, long, Generic, Generic, bool>(Buffer)>()(t2)));
+  EXPECT_THROW(scale(t2, Int(2)), std::runtime_error);
+  EXPECT_EQ(2, ints[1]);
+}
+
+TEST_F(Test, MemoryLifetime) {
+  auto sum = module_.GetAttribute("sum_buffer").ToFunc();
+  int released = 0;
+  {
+    std::vector<float> values(100, 0.5f);
+    auto t0 = Buffer::FromMemory(values.data(), { 10, 10 }, {}, [&released]() { released++; });
+    auto array = Import("numpy").GetAttribute("asarray").ToFunc()(t0);
+    t0 = Buffer::FromMemory(values.data(), { 100 });
+    // ndarray still refers to the first export
+    EXPECT_EQ(0, released);
+    EXPECT_DOUBLE_EQ(50, sum(array).ToValue().ToFloat());
+  }
+  EXPECT_EQ(1, released);
+
+  auto t1 = Buffer::FromVector(std::vector<uint8_t>(256, 1), { 16, 16 });
+  EXPECT_EQ("B", t1.Format());
+  EXPECT_EQ((std::vector<size_t>{ 16, 16 }), t1.Shape());
+  EXPECT_DOUBLE_EQ(256, sum(t1).ToValue().ToFloat());
+  EXPECT_DOUBLE_EQ(3, sum(Buffer::FromVector(std::vector<int64_t>{ 1, 2 })).ToValue().ToFloat());
+
+  EXPECT_THROW(Buffer::FromMemory(&released, { 1 }, { 4, 4 }), std::logic_error);
+  EXPECT_THROW(Buffer::FromVector(std::vector<double>(2), { 1000, 1000 }), std::logic_error);
+  EXPECT_THROW(Buffer::FromVector(std::vector<double>(2), { 3 }), std::logic_error);
+  // the product wraps around to 2 without the overflow guard
+  EXPECT_THROW(Buffer::FromVector(std::vector<double>(2), { (size_t(1) << 63) + 1, 2 }), std::logic_error);
+  EXPECT_EQ(0u, Buffer::FromVector(std::vector<double>(), { 0, 4 }).Length());
+}
+
+TEST_F(Test, BufferView) {
+  auto buf = module_.GetAttribute("make_matrix").ToFunc()().ToBuffer();
+  EXPECT_EQ(4u, buf.Shape(1));
+  EXPECT_EQ(8, buf.Strides(1));
+  EXPECT_THROW(buf.Shape(2), std::out_of_range);
+  EXPECT_FALSE(buf.ReadOnly());
+
+  BufferView<double, 2> t0(buf);
+  EXPECT_TRUE(t0.IsContiguous());
+  EXPECT_EQ(12u, t0.Size());
+  EXPECT_EQ(3u, t0.Shape(0));
+  EXPECT_DOUBLE_EQ(6, t0(1, 2));
+  EXPECT_DOUBLE_EQ(7, t0[1][3]);
+  EXPECT_DOUBLE_EQ(11, t0.Flat()[11]);
+  double sum = 0;
+  for (const auto& v : t0) {
+    sum += v;
+  }
+  EXPECT_DOUBLE_EQ(66, sum);
+  t0[2][0] = -1;
+  EXPECT_DOUBLE_EQ(-1, buf.Data<double>()[8]);
+
+  EXPECT_THROW((BufferView<float, 2>(buf)), std::bad_cast);
+  EXPECT_THROW((BufferView<double, 3>(buf)), std::bad_cast);
+  // the view borrows the memory, so keep the buffer alive
+  auto matrix = module_.GetAttribute("make_int_matrix").ToFunc()().ToBuffer();
+  BufferView<const int64_t, 2> t1(matrix);
+  EXPECT_EQ(5, t1(1, 1));
+
+  // transposed, non-contiguous
+  std::vector<double> values = { 0, 1, 2, 3, 4, 5 };
+  auto t2 = Buffer::FromMemory(values.data(), { 3, 2 }, { 8, 24 });
+  BufferView<double, 2> t3(t2);
+  EXPECT_FALSE(t3.IsContiguous());
+  EXPECT_THROW(t3.Flat(), std::logic_error);
+  EXPECT_FALSE(t3[0].IsContiguous());
+  EXPECT_DOUBLE_EQ(4, t3(1, 1));
+  std::vector<double> visited(t3.begin(), t3.end());
+  EXPECT_EQ((std::vector<double>{ 0, 3, 1, 4, 2, 5 }), visited);
+
+  const std::vector<double> frozen = { 1, 2 };
+  auto t4 = Buffer::FromMemory(frozen.data(), { 2 });
+  EXPECT_THROW((BufferView<double, 1>(t4)), std::bad_cast);
+  EXPECT_DOUBLE_EQ(2, (BufferView<const double, 1>(t4)[1]));
+}
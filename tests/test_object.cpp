@@ -0,0 +1,192 @@
+#include "test_root.h"
+#include <type_traits>
+
+TEST_F(Test, ObjectCopy) {
+  EXPECT_EQ(sizeof(void*), sizeof(Object));
+  EXPECT_EQ(sizeof(void*), sizeof(Value));
+
+  auto v0 = Float(12345.5);
+  auto base = RefCount(v0);
+  {
+    auto v1 = v0;
+    EXPECT_EQ(base + 1, RefCount(v0));
+    auto v2 = Float(0.5);
+    v2 = v0;
+    EXPECT_EQ(base + 2, RefCount(v0));
+    v2 = v2;
+    EXPECT_EQ(base + 2, RefCount(v0));
+    EXPECT_EQ(v0.GetRef(), v2.GetRef());
+  }
+  EXPECT_EQ(base, RefCount(v0));
+
+  Object none;
+  EXPECT_TRUE(none.IsNone());
+  none = v0;
+  EXPECT_FALSE(none.IsNone());
+  EXPECT_EQ(base + 1, RefCount(v0));
+}
+
+TEST_F(Test, BufferCopy) {
+  auto buf = module_.GetAttribute("make_buffer").ToFunc()().ToBuffer();
+  auto base = RefCount(buf);
+  {
+    auto copied = buf;
+    EXPECT_EQ(base + 1, RefCount(buf));
+    EXPECT_EQ(buf.Data(), copied.Data());
+    EXPECT_EQ(buf.Length(), copied.Length());
+  }
+  EXPECT_EQ(base, RefCount(buf));
+  EXPECT_STREQ("ndarray", buf.Type().c_str());
+  EXPECT_STREQ("f", buf.Format().c_str());
+}
+
+TEST_F(Test, ObjectMove) {
+  EXPECT_TRUE(std::is_nothrow_move_constructible<Object>::value);
+  EXPECT_TRUE(std::is_nothrow_move_constructible<Generic>::value);
+  EXPECT_TRUE(std::is_nothrow_move_constructible<Value>::value);
+  EXPECT_TRUE(std::is_nothrow_move_constructible<Buffer>::value);
+  EXPECT_TRUE(std::is_nothrow_move_assignable<Object>::value);
+  EXPECT_TRUE(std::is_nothrow_move_assignable<Buffer>::value);
+
+  auto v0 = Float(12345.5);
+  auto base = RefCount(v0);
+  {
+    auto v1 = std::move(v0);
+    EXPECT_EQ(nullptr, v0.GetRef());
+    EXPECT_EQ(base, RefCount(v1));
+    v0 = std::move(v1);
+    EXPECT_EQ(nullptr, v1.GetRef());
+  }
+  EXPECT_EQ(base, RefCount(v0));
+
+  std::vector<Value> values;
+  for (int i = 0; i < 100; ++i) {
+    values.push_back(v0);
+  }
+  EXPECT_EQ(base + 100, RefCount(v0));
+  values.clear();
+  EXPECT_EQ(base, RefCount(v0));
+}
+
+TEST_F(Test, GenericMove) {
+  auto echo = module_.GetAttribute("echo").ToFunc();
+  auto v0 = Float(12345.5);
+  auto base = RefCount(v0);
+
+  {
+    // invoke and convert with copy
+    auto g0 = echo(v0);
+    auto base_g = RefCount(v0);
+    auto v1 = g0.ToValue();
+    EXPECT_EQ(base_g + 1, RefCount(v0));
+    EXPECT_EQ(v0.GetRef(), g0.GetRef());
+
+    // invoke and convert with move
+    auto g1 = echo(v0);
+    auto base_m = RefCount(v0);
+    auto v2 = std::move(g1).ToValue();
+    EXPECT_EQ(base_m, RefCount(v0));
+    EXPECT_EQ(nullptr, g1.GetRef());
+    EXPECT_FLOAT_EQ(12345.5, v2.ToFloat());
+
+    // failed conversion keeps the reference
+    auto g2 = echo(v0);
+    try {
+      auto t = std::move(g2).ToTuple();
+      FAIL();
+    }
+    catch (std::bad_cast&) {
+      EXPECT_EQ(v0.GetRef(), g2.GetRef());
+    }
+  }
+  // every handle above is gone
+  EXPECT_EQ(base, RefCount(v0));
+
+  auto buf = module_.GetAttribute("make_buffer").ToFunc()().ToBuffer();
+  auto moved = std::move(buf);
+  EXPECT_EQ(nullptr, buf.GetRef());
+  EXPECT_EQ(6 * 4, moved.Length());
+}
+
+TEST_F(Test, CallMethod) {
+  auto counter = module_.GetAttribute("Counter").ToFunc()();
+  EXPECT_EQ(1, counter.CallMethod("add").ToValue().ToInt());
+  EXPECT_EQ(3, counter.CallMethod("add", Int(2)).ToValue().ToInt());
+  EXPECT_EQ(8, counter.CallMethod("add", Int(2), Int(3)).ToValue().ToInt());
+  EXPECT_EQ(8, counter.GetAttribute("count").ToValue().ToInt());
+
+  auto text = Str("a,b,c");
+  EXPECT_EQ(3, text.CallMethod("split", Str(",")).ToList().Size());
+  EXPECT_STREQ("A,B,C", text.CallMethod("upper").ToValue().ToString().c_str());
+
+  try {
+    counter.CallMethod("missing");
+    FAIL();
+  }
+  catch (std::runtime_error& e) {
+    EXPECT_STREQ("failed to run method", e.what());
+  }
+}
+
+TEST_F(Test, Name) {
+  const auto echo = Name("echo");
+  const auto value = Name("value");
+  EXPECT_STREQ("str", echo.Type().c_str());
+  EXPECT_EQ(Str("echo").Hash(), echo.Hash());
+
+  EXPECT_TRUE(module_.ContainsAttribute(echo));
+  EXPECT_EQ(
+    module_.GetAttribute("echo").GetRef(),
+    module_.GetAttribute(echo).GetRef());
+
+  auto counter = module_.GetAttribute("Counter").ToFunc()();
+  EXPECT_FALSE(counter.ContainsAttribute(value));
+  EXPECT_TRUE(counter.SetAttribute(value, Int(3)));
+  EXPECT_EQ(3, counter.GetAttribute(value).ToValue().ToInt());
+  EXPECT_EQ(3, counter.GetAttribute("value").ToValue().ToInt());
+  EXPECT_TRUE(counter.RemoveAttribute(value));
+  EXPECT_FALSE(counter.RemoveAttribute(value));
+  EXPECT_FALSE(counter.ContainsAttribute("value"));
+
+  EXPECT_EQ(5, counter.CallMethod(Name("add"), Int(5)).ToValue().ToInt());
+
+  auto dict = Dict();
+  dict.Set(value, Int(1));
+  EXPECT_EQ(1, dict.Get("value").ToValue().ToInt());
+  EXPECT_EQ(1, dict.Get(value).ToValue().ToInt());
+
+  try {
+    module_.GetAttribute(value);
+    FAIL();
+  }
+  catch (std::logic_error& e) {
+    EXPECT_STREQ("not found", e.what());
+  }
+}
+
+TEST_F(Test, AttributeCache) {
+  auto cache = AttributeCache(module_);
+  auto echo = cache.Get(Name("echo"));
+  EXPECT_EQ(echo.GetRef(), cache.Get("echo").GetRef());
+  EXPECT_EQ(echo.GetRef(), module_.GetAttribute("echo").GetRef());
+  EXPECT_EQ(1, echo.ToFunc()(Int(1)).ToValue().ToInt());
+
+  // reloading creates new function objects
+  Reload(module_);
+  auto reloaded = cache.Get("echo");
+  EXPECT_NE(echo.GetRef(), reloaded.GetRef());
+  EXPECT_EQ(reloaded.GetRef(), module_.GetAttribute("echo").GetRef());
+
+  module_.SetAttribute("echo", Int(0));
+  EXPECT_EQ(reloaded.GetRef(), cache.Get("echo").GetRef());
+  cache.Clear();
+  EXPECT_EQ(0, cache.Get("echo").ToValue().ToInt());
+
+  try {
+    cache.Get("missing");
+    FAIL();
+  }
+  catch (std::logic_error& e) {
+    EXPECT_STREQ("not found", e.what());
+  }
+}
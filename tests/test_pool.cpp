@@ -0,0 +1,162 @@
+#include "test_root.h"
+#include <algorithm>
+#include <mutex>
+
+// Submit rejects results holding objects of the worker interpreter
+static_assert(detail::HoldsObject<Value>::value, "");
+static_assert(detail::HoldsObject<std::vector<std::pair<std::string, Func>>>::value, "");
+static_assert(!detail::HoldsObject<std::map<std::string, std::vector<long>>>::value, "");
+
+TEST_F(Test, InterpreterPool) {
+  InterpreterPoolConfig config;
+  config.workers = 2;
+  config.modules = { "worker" };
+  InterpreterPool pool(config);
+  EXPECT_EQ(2u, pool.Size());
+  auto main_increment = Import("worker").GetAttribute("increment").ToFunc();
+
+  // wait without holding the main GIL (required when the GIL is shared)
+  GILContext context;
+  std::vector<std::future<long>> results;
+  for (int i = 0; i < 8; ++i) {
+    results.push_back(pool.Submit([](Interpreter& interpreter) {
+      return interpreter.Function("worker", "count_primes").Typed<long(long)>()(1000);
+    }));
+  }
+  for (auto& r : results) {
+    EXPECT_EQ(168, r.get());
+  }
+
+  // module state is isolated per interpreter
+  auto increment = [](Interpreter& interpreter) {
+    return interpreter.Function("worker", "increment").Typed<long()>()();
+  };
+  pool.SubmitTo(0, increment).wait();
+  EXPECT_EQ(2, pool.SubmitTo(0, increment).get());
+  EXPECT_EQ(1, pool.SubmitTo(1, increment).get());
+  EXPECT_EQ(1u, pool.SubmitTo(1, [](Interpreter& interpreter) {
+    return interpreter.Index();
+  }).get());
+
+  // caches are per interpreter too
+  EXPECT_EQ(3, pool.SubmitTo(0, [](Interpreter&) {
+    EnableValueCache();
+    auto value = Int(3).ToInt();
+    return GetValueCacheStats().int_hits == 1 ? value : -1L;
+  }).get());
+
+  // batch calls run on the interpreter of the worker
+  auto absolutes = pool.Submit([](Interpreter& interpreter) {
+    std::vector<long> outputs;
+    interpreter.Function("builtins", "abs").Map(std::vector<long>{ -1, 2, -3 }, outputs);
+    return outputs;
+  }).get();
+  EXPECT_EQ(std::vector<long>({ 1, 2, 3 }), absolutes);
+
+  auto failed = pool.Submit([](Interpreter& interpreter) {
+    return interpreter.Function("worker", "missing").Typed<long()>()();
+  });
+  EXPECT_THROW(failed.get(), std::logic_error);
+
+  context.Scope([&main_increment]() {
+    EXPECT_EQ(1, main_increment().ToValue().ToInt());
+    EXPECT_EQ(0u, GetValueCacheStats().int_hits);
+  });
+  context.Release();
+}
+
+TEST_F(Test, InterpreterPoolAbnormal) {
+  InterpreterPoolConfig config;
+  config.workers = 1;
+  config.modules = { "no_such_module" };
+  EXPECT_THROW(InterpreterPool pool(config), std::runtime_error);
+  // the main interpreter still works
+  EXPECT_EQ(2, module_.GetAttribute("echo").ToFunc()(Int(2)).ToValue().ToInt());
+}
+
+TEST_F(Test, ShardedExecutor) {
+  ShardedExecutorConfig config;
+  config.pool.workers = 2;
+  config.pool.modules = { "worker" };
+  // every key starts on shard 0
+  config.hash = [](const std::string&) { return size_t(0); };
+  config.export_state = [](Interpreter& interpreter, const std::string& key) {
+    return interpreter.Function("worker", "export_state").Typed<std::string(std::string)>()(key);
+  };
+  config.import_state = [](Interpreter& interpreter, const std::string& key, const std::string& state) {
+    interpreter.Function("worker", "import_state").Typed<void(std::string, std::string)>()(key, state);
+  };
+  ShardedExecutor executor(config);
+  EXPECT_EQ(2u, executor.Size());
+
+  GILContext context;
+  auto add = [&executor](const std::string& key) {
+    return executor.Submit(key, [key](Interpreter& interpreter) {
+      return interpreter.Function("worker", "add").Typed<long(std::string, long)>()(key, 1);
+    });
+  };
+  std::vector<std::future<long>> results;
+  for (int i = 0; i < 6; ++i) {
+    results.push_back(add("hot"));
+  }
+  for (int i = 0; i < 3; ++i) {
+    results.push_back(add("warm"));
+  }
+  results.push_back(add("cold"));
+  EXPECT_EQ(6, results[5].get());
+  EXPECT_EQ(3, results[8].get());
+
+  EXPECT_EQ(1u, executor.Rebalance());
+  EXPECT_EQ(1u, executor.ShardOf("hot"));
+  EXPECT_EQ(0u, executor.ShardOf("warm"));
+  // state followed the key
+  EXPECT_EQ(7, add("hot").get());
+  EXPECT_EQ(4, add("warm").get());
+  // load is counted again from zero
+  EXPECT_EQ(0u, executor.Rebalance());
+
+  auto stats = executor.Stats();
+  EXPECT_EQ(11u, stats[0].submitted);
+  EXPECT_EQ(1u, stats[1].submitted);
+  EXPECT_EQ(1u, stats[1].keys_moved_in);
+  EXPECT_LE(1u, stats[0].max_depth);
+  for (const auto& s : stats) {
+    EXPECT_EQ(s.submitted, s.completed + s.depth);
+  }
+  context.Release();
+}
+
+TEST_F(Test, ShardedExecutorOrder) {
+  ShardedExecutorConfig config;
+  config.pool.workers = 2;
+  // every key starts on shard 0, and state is not handed over
+  config.hash = [](const std::string&) { return size_t(0); };
+  ShardedExecutor executor(config);
+
+  GILContext context;
+  std::mutex mutex;
+  std::vector<int> order;
+  auto record = [&executor, &mutex, &order](const std::string& key, const int& value, const double& delay) {
+    return executor.Submit(key, [&mutex, &order, value, delay](Interpreter& interpreter) {
+      // sleeping in Python lets the other shard run even when the GIL is shared
+      interpreter.Function("time", "sleep").Typed<void(double)>()(delay);
+      std::lock_guard<std::mutex> lock(mutex);
+      order.push_back(value);
+    });
+  };
+  std::vector<std::future<void>> results;
+  results.push_back(record("hot", 1, 0.2));
+  results.push_back(record("hot", 2, 0));
+  results.push_back(record("hot", 3, 0));
+  results.push_back(record("cold", 0, 0));
+  EXPECT_EQ(1u, executor.Rebalance());
+  EXPECT_EQ(1u, executor.ShardOf("hot"));
+  // runs on the new shard only after the tasks left on the old one
+  results.push_back(record("hot", 4, 0));
+  for (auto& r : results) {
+    r.get();
+  }
+  order.erase(std::remove(order.begin(), order.end(), 0), order.end());
+  EXPECT_EQ((std::vector<int>{ 1, 2, 3, 4 }), order);
+  context.Release();
+}
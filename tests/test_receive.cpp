@@ -37,3 +37,33 @@ TEST_F(Test, Receive) {
   EXPECT_EQ(10, dict.Get(Float(1.0)).ToValue().ToInt());
   EXPECT_FLOAT_EQ(0.1, dict.Get("key2").ToValue().ToFloat());
 }
+
+TEST_F(Test, ReceiveUnpack) {
+  auto make_tuple = module_.GetAttribute("make_tuple").ToFunc();
+  auto make_list = module_.GetAttribute("make_list").ToFunc();
+
+  auto [label, count, score] = make_tuple().ToTuple().Unpack<std::string, int, double>();
+  EXPECT_EQ("str", label);
+  EXPECT_EQ(10, count);
+  EXPECT_DOUBLE_EQ(0.1, score);
+
+  auto t0 = make_list().ToList().Unpack<std::string, long, float>();
+  EXPECT_EQ("str", std::get<0>(t0));
+  EXPECT_EQ(10, std::get<1>(t0));
+  EXPECT_FLOAT_EQ(0.1f, std::get<2>(t0));
+
+  auto t1 = make_tuple().Unpack<Generic, long, double>();
+  EXPECT_EQ("str", std::get<0>(t1).ToValue().ToString());
+  auto t2 = make_list().Unpack<std::string, Value, Generic>();
+  EXPECT_EQ(10, std::get<1>(t2).ToInt());
+  EXPECT_EQ(std::tuple<>(), Tuple(std::vector<Object>()).Unpack<>());
+}
+
+TEST_F(Test, ReceiveUnpackAbnormal) {
+  auto make_tuple = module_.GetAttribute("make_tuple").ToFunc();
+  EXPECT_THROW((make_tuple().ToTuple().Unpack<std::string, int>()), std::bad_cast);
+  EXPECT_THROW((make_tuple().ToTuple().Unpack<std::string, int, double, int>()), std::bad_cast);
+  EXPECT_THROW((make_tuple().ToTuple().Unpack<int, int, double>()), std::bad_cast);
+  EXPECT_THROW((module_.GetAttribute("make_dict").ToFunc()().Unpack<int>()), std::bad_cast);
+  EXPECT_THROW((module_.GetAttribute("make_empty").ToFunc()().Unpack<int>()), std::bad_cast);
+}
@@ -3,6 +3,11 @@
 
 using namespace poppy;
 
+inline auto RefCount(const Object& obj) -> long {
+  auto getrefcount = Import("sys").GetAttribute("getrefcount").ToFunc();
+  return getrefcount(obj).ToValue().ToInt();
+}
+
 class Test : public testing::Test {
 protected:
   Test() : module_(Init()) {}
@@ -1,4 +1,6 @@
 #include "test_root.h"
+#include <atomic>
+#include <chrono>
 #include <thread>
 
 TEST_F(Test, Thread) {
@@ -30,6 +32,8 @@ TEST_F(Test, Thread) {
     });
   }
   th.join();
+  // restore GIL before the objects above are destroyed
+  context.Release();
 
   EXPECT_EQ(100020, sum);
 }
@@ -91,6 +95,177 @@ TEST_F(ThreadingTest, ThreadClassMember) {
     });
   }
   th.join();
+  // restore GIL before the objects above are destroyed
+  context_.Release();
 
   EXPECT_EQ(100020, sum);
 }
+
+TEST_F(Test, GILExecutor) {
+  auto echo = module_.GetAttribute("echo").ToFunc();
+  GILExecutorConfig config;
+  config.max_batch = 8;
+  GILExecutor executor(config);
+  GILContext context;
+
+  std::vector<std::thread> threads;
+  std::vector<long> sums(4, 0);
+  for (size_t t = 0; t < sums.size(); ++t) {
+    threads.emplace_back([&executor, &echo, &sums, t]() {
+      std::vector<std::future<long>> results;
+      for (long i = 0; i < 1000; ++i) {
+        results.push_back(executor.Submit([&echo, i]() {
+          return echo(Int(i)).ToValue().ToInt();
+        }));
+      }
+      for (auto& r : results) {
+        sums[t] += r.get();
+      }
+    });
+  }
+  for (auto& th : threads) {
+    th.join();
+  }
+  for (const auto& s : sums) {
+    EXPECT_EQ(499500, s);
+  }
+
+  auto failed = executor.Submit([&echo]() {
+    return echo.GetAttribute("missing").ToValue().ToInt();
+  });
+  EXPECT_THROW(failed.get(), std::logic_error);
+
+  // callbacks run in order, and queued ones finish before destruction
+  std::vector<int> order;
+  {
+    GILExecutor local;
+    for (int i = 0; i < 100; ++i) {
+      local.Post([&order, i]() {
+        order.push_back(static_cast<int>(Int(i).ToInt()));
+      });
+    }
+  }
+  ASSERT_EQ(100u, order.size());
+  EXPECT_EQ(99, order.back());
+  // the count drops right after the future is ready, so give it a moment
+  for (int i = 0; i < 1000 && executor.Pending(); ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  EXPECT_EQ(0u, executor.Pending());
+  context.Release();
+}
+
+TEST_F(Test, GILGuards) {
+  auto echo = module_.GetAttribute("echo").ToFunc();
+  std::atomic<long> sum(0);
+  {
+    // the main thread holds the GIL here, so this is a no-op
+    GILAcquire outer;
+    GILRelease release;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+      threads.emplace_back([&echo, &sum]() {
+        for (int i = 0; i < 100; ++i) {
+          GILAcquire acquire;
+          GILAcquire nested;
+          auto value = echo(Int(i)).ToValue().ToInt();
+          {
+            // plain C++ work lets the other threads run Python
+            GILRelease work;
+            sum += value;
+          }
+          sum += echo(Int(0)).ToValue().ToInt();
+        }
+      });
+    }
+    for (auto& th : threads) {
+      th.join();
+    }
+  }
+  EXPECT_EQ(4 * 4950, sum.load());
+  EXPECT_EQ(3, echo(Int(3)).ToValue().ToInt());
+}
+
+TEST_F(Test, GILAcquireWaits) {
+  auto echo = module_.GetAttribute("echo").ToFunc();
+  std::atomic<bool> acquired(false);
+  // the main thread holds the GIL, which must not count for another thread
+  std::thread th([&echo, &acquired]() {
+    GILAcquire acquire;
+    acquired = true;
+    echo(Int(1));
+  });
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  EXPECT_FALSE(acquired.load());
+  {
+    GILRelease release;
+    th.join();
+  }
+  EXPECT_TRUE(acquired.load());
+}
+
+TEST_F(Test, GILContextNested) {
+  auto echo = module_.GetAttribute("echo").ToFunc();
+  GILContext context;
+  long sum = 0;
+  std::thread th([&context, &echo, &sum]() {
+    context.Lock();
+    context.Lock();
+    sum += echo(Int(1)).ToValue().ToInt();
+    context.Unlock();
+    sum += echo(Int(2)).ToValue().ToInt();
+    context.Unlock();
+    EXPECT_THROW(context.Unlock(), std::logic_error);
+  });
+  th.join();
+  EXPECT_EQ(3, sum);
+  context.Release();
+}
+
+TEST_F(Test, ThreadRegistration) {
+  auto counter = module_.GetAttribute("local_counter").ToFunc().Typed<long()>();
+  EXPECT_FALSE(ThreadRegistration::IsRegistered());
+  GILRelease release;
+
+  long registered = 0;
+  long unregistered = 0;
+  std::thread th0([&counter, &registered]() {
+    ThreadRegistration registration;
+    ThreadRegistration nested;
+    EXPECT_TRUE(ThreadRegistration::IsRegistered());
+    for (int i = 0; i < 3; ++i) {
+      GILAcquire acquire;
+      registered = counter();
+    }
+  });
+  std::thread th1([&counter, &unregistered]() {
+    EXPECT_FALSE(ThreadRegistration::IsRegistered());
+    for (int i = 0; i < 3; ++i) {
+      GILAcquire acquire;
+      unregistered = counter();
+    }
+  });
+  th0.join();
+  th1.join();
+  // Python thread-local data survives only with a persistent thread state
+  EXPECT_EQ(3, registered);
+  EXPECT_EQ(1, unregistered);
+}
+
+TEST_F(Test, ThreadRegistrationContext) {
+  auto counter = module_.GetAttribute("local_counter").ToFunc().Typed<long()>();
+  GILContext context;
+  long count = 0;
+  std::thread th([&context, &counter, &count]() {
+    ThreadRegistration registration;
+    for (int i = 0; i < 3; ++i) {
+      context.Lock();
+      count = counter();
+      context.Unlock();
+    }
+  });
+  th.join();
+  // GILContext::Lock swaps the registered thread state in as well
+  EXPECT_EQ(3, count);
+  context.Release();
+}
@@ -38,3 +38,29 @@ TEST_F(Test, TupleAbnormal) {
     FAIL();
   }
 }
+
+TEST_F(Test, TupleIterator) {
+  auto t0 = Tuple(Int(0), Str("one"), Float(0.5));
+  EXPECT_EQ(3, std::distance(t0.begin(), t0.end()));
+  EXPECT_EQ("str", t0[1].Type());
+  EXPECT_EQ(t0.Get(2).GetRef(), t0[2].GetRef());
+
+  int i = 0;
+  for (const auto& item : t0) {
+    EXPECT_EQ(t0.Get(i++).GetRef(), item.GetRef());
+  }
+  EXPECT_EQ(3, i);
+  EXPECT_EQ(t0.Get(2).GetRef(), (*(t0.end() - 1)).GetRef());
+
+  auto t1 = Tuple(std::vector<Object>());
+  EXPECT_TRUE(t1.begin() == t1.end());
+}
+
+TEST_F(Test, TupleToVector) {
+  auto t0 = Tuple(Int(1), Int(-2), Int(3));
+  EXPECT_EQ((std::vector<long long>{ 1, -2, 3 }), t0.ToVector<long long>());
+  EXPECT_EQ((std::vector<double>{ 1, -2, 3 }), t0.ToVector<double>());
+  EXPECT_EQ((std::vector<std::string>{ "x", "y" }),
+    Tuple(Str("x"), Str("y")).ToVector<std::string>());
+  EXPECT_THROW(Tuple(Int(1), Float(0.5)).ToVector<int>(), std::bad_cast);
+}
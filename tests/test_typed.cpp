@@ -0,0 +1,138 @@
+#include "test_root.h"
+#include <cstdint>
+
+struct Point {
+  double x;
+  double y;
+};
+
+namespace poppy {
+
+// user-defined converters compose the built-in ones
+template<>
+struct ToPython<Point> {
+  static auto Convert(const Point& value) -> void* {
+    return ToPython<std::tuple<double, double>>::Convert(std::make_tuple(value.x, value.y));
+  }
+};
+
+template<>
+struct FromPython<Point> {
+  static auto Convert(void* obj) -> Point {
+    auto values = FromPython<std::pair<double, double>>::Convert(obj);
+    return Point{ values.first, values.second };
+  }
+};
+
+}  // namespace poppy
+
+TEST_F(Test, TypedFunc) {
+  auto echo = module_.GetAttribute("echo").ToFunc();
+  EXPECT_EQ(3, echo.Typed<long(long)>()(3));
+  EXPECT_EQ(-3, echo.Typed<int(short)>()(-3));
+  EXPECT_EQ(18446744073709551615ull,
+    echo.Typed<unsigned long long(unsigned long long)>()(18446744073709551615ull));
+  EXPECT_DOUBLE_EQ(0.25, echo.Typed<double(double)>()(0.25));
+  EXPECT_DOUBLE_EQ(2.0, echo.Typed<double(int)>()(2));
+  EXPECT_TRUE(echo.Typed<bool(bool)>()(true));
+  EXPECT_EQ("hello", echo.Typed<std::string(const std::string&)>()("hello"));
+  EXPECT_EQ("tuple", echo.Typed<Generic(Tuple)>()(Tuple(Int(1))).Type());
+
+  auto echo_args = module_.GetAttribute("echo_args").ToFunc();
+  auto f0 = echo_args.Typed<std::tuple<>()>();
+  EXPECT_EQ(std::tuple<>(), f0());
+  auto f3 = echo_args.Typed<std::tuple<std::string, long, double>(std::string, long, double)>();
+  auto ret = f3("str", 10, 0.5);
+  EXPECT_EQ("str", std::get<0>(ret));
+  EXPECT_EQ(10, std::get<1>(ret));
+  EXPECT_DOUBLE_EQ(0.5, std::get<2>(ret));
+
+  auto make_list = module_.GetAttribute("make_list").ToFunc();
+  auto [label, count, score] = make_list.Typed<std::tuple<std::string, int, double>()>()();
+  EXPECT_EQ("str", label);
+  EXPECT_EQ(10, count);
+  EXPECT_DOUBLE_EQ(0.1, score);
+
+  auto make_empty = module_.GetAttribute("make_empty").ToFunc().Typed<void()>();
+  make_empty();
+  EXPECT_EQ("make_empty", make_empty.GetFunc().GetAttribute("__name__").ToValue().ToString());
+}
+
+TEST_F(Test, TypedFuncAbnormal) {
+  auto echo = module_.GetAttribute("echo").ToFunc();
+  EXPECT_THROW(echo.Typed<long(double)>()(0.5), std::bad_cast);
+  EXPECT_THROW(echo.Typed<bool(long)>()(1), std::bad_cast);
+  EXPECT_THROW(echo.Typed<std::string(long)>()(1), std::bad_cast);
+  EXPECT_THROW(echo.Typed<int(long)>()(1L << 40), std::bad_cast);
+  EXPECT_THROW(echo.Typed<unsigned int(int)>()(-1), std::bad_cast);
+  EXPECT_THROW(echo.Typed<std::string(std::string)>()("\xff"), std::bad_cast);
+  EXPECT_THROW((echo.Typed<std::tuple<long, long>(Tuple)>()(Tuple(Int(1)))), std::bad_cast);
+  EXPECT_THROW((echo.Typed<std::tuple<long>(long)>()(1)), std::bad_cast);
+
+  auto echo_fail = module_.GetAttribute("echo_fail").ToFunc();
+  try {
+    echo_fail.Typed<long(long)>()(1);
+    FAIL();
+  }
+  catch (std::runtime_error& e) {
+    EXPECT_STREQ("failed to run function", e.what());
+  }
+}
+
+TEST_F(Test, Converter) {
+  auto echo = module_.GetAttribute("echo").ToFunc();
+
+  auto f0 = echo.Typed<std::vector<std::vector<double>>(std::vector<std::vector<double>>)>();
+  auto v0 = std::vector<std::vector<double>>{ { 0.5, 1.5 }, {}, { -1 } };
+  EXPECT_EQ(v0, f0(v0));
+
+  auto f1 = echo.Typed<std::map<std::string, std::vector<int64_t>>(
+    std::map<std::string, std::vector<int64_t>>)>();
+  auto v1 = std::map<std::string, std::vector<int64_t>>{
+    { "a", { INT64_MIN, INT64_MAX } }, { "b", {} } };
+  EXPECT_EQ(v1, f1(v1));
+
+  auto f2 = echo.Typed<std::unordered_map<long, std::string>(std::unordered_map<long, std::string>)>();
+  auto v2 = std::unordered_map<long, std::string>{ { 1, "one" }, { -2, "two" } };
+  EXPECT_EQ(v2, f2(v2));
+
+  auto f3 = echo.Typed<std::array<float, 3>(std::array<float, 3>)>();
+  EXPECT_EQ((std::array<float, 3>{ 0.5f, 1.0f, -2.0f }), f3({ 0.5f, 1.0f, -2.0f }));
+
+  auto f4 = echo.Typed<std::optional<uint64_t>(std::optional<uint64_t>)>();
+  EXPECT_EQ(UINT64_MAX, f4(UINT64_MAX));
+  EXPECT_FALSE(f4(std::nullopt).has_value());
+
+  auto f5 = echo.Typed<std::string(std::string_view)>();
+  EXPECT_EQ("view", f5(std::string_view("view-string", 4)));
+  EXPECT_EQ("literal", (echo.Typed<std::string(const char*)>()("literal")));
+
+  auto f6 = echo.Typed<std::pair<std::string, bool>(std::tuple<std::string, bool>)>();
+  EXPECT_EQ(std::make_pair(std::string("x"), true), f6(std::make_tuple(std::string("x"), true)));
+
+  auto f7 = echo.Typed<std::vector<Point>(std::vector<Point>)>();
+  auto v7 = f7({ Point{ 1, 2 }, Point{ 3, 4 } });
+  ASSERT_EQ(2, v7.size());
+  EXPECT_DOUBLE_EQ(3, v7[1].x);
+  EXPECT_DOUBLE_EQ(4, v7[1].y);
+
+  auto f8 = echo.Typed<List(std::vector<long>)>();
+  EXPECT_EQ(3, f8({ 1, 2, 3 }).Size());
+  auto f9 = echo.Typed<Dict(std::map<std::string, Value>)>();
+  EXPECT_EQ(1, f9({ { "a", Int(1) }, { "b", Str("2") } }).Get("a").ToValue().ToInt());
+
+  EXPECT_EQ(INT64_MIN, FromPython<int64_t>::Convert(Int(INT64_MIN).GetRef()));
+  EXPECT_EQ(UINT64_MAX, FromPython<uint64_t>::Convert(Int(UINT64_MAX).GetRef()));
+}
+
+TEST_F(Test, ConverterAbnormal) {
+  auto echo = module_.GetAttribute("echo").ToFunc();
+  EXPECT_THROW((echo.Typed<std::array<long, 2>(std::vector<long>)>()({ 1, 2, 3 })), std::bad_cast);
+  EXPECT_THROW((echo.Typed<std::vector<long>(std::vector<double>)>()({ 0.5 })), std::bad_cast);
+  EXPECT_THROW((echo.Typed<std::map<long, long>(std::vector<long>)>()({ 1 })), std::bad_cast);
+  EXPECT_THROW((echo.Typed<std::vector<long>(std::map<long, long>)>()({ { 1, 1 } })), std::bad_cast);
+  EXPECT_THROW((echo.Typed<std::optional<long>(std::string)>()("1")), std::bad_cast);
+  EXPECT_THROW((echo.Typed<Dict(std::vector<long>)>()({ 1 })), std::bad_cast);
+  EXPECT_THROW((echo.Typed<Generic(std::map<Tuple, long>)>()({ { Tuple(List()), 1 } })),
+    std::bad_cast);
+}
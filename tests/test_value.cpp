@@ -1,4 +1,5 @@
 #include "test_root.h"
+#include <limits>
 
 TEST_F(Test, CastToBool) {
   // check type name
@@ -178,3 +179,82 @@ TEST_F(Test, Compare) {
   EXPECT_LE(v1, v2);
   EXPECT_EQ(v2, v3);
 }
+
+TEST_F(Test, ValueCache) {
+  ValueCacheConfig config;
+  config.int_min = -10;
+  config.int_max = 300;
+  config.string_capacity = 2;
+  config.string_max_length = 8;
+  EnableValueCache(config);
+
+  EXPECT_EQ(Int(300).GetRef(), Int(300).GetRef());
+  EXPECT_EQ(Int(-10).GetRef(), Value::FromInt(-10).GetRef());
+  EXPECT_EQ(300, Int(300).ToInt());
+  Int(301);
+  auto stats = GetValueCacheStats();
+  EXPECT_EQ(5, stats.int_hits);
+  EXPECT_EQ(1, stats.int_misses);
+
+  auto a = Str("aa");
+  EXPECT_EQ(a.GetRef(), Str("aa").GetRef());
+  EXPECT_EQ("aa", Str("aa").ToString());
+  Str("bb");
+  Str("cc");
+  Str("too long string");
+  stats = GetValueCacheStats();
+  EXPECT_EQ(2, stats.string_hits);
+  EXPECT_EQ(4, stats.string_misses);
+  EXPECT_EQ(1, stats.string_evictions);
+  EXPECT_EQ(2, stats.string_entries);
+  // evicted entry is still valid while referenced
+  EXPECT_EQ("aa", a.ToString());
+  Str("aa");
+  EXPECT_EQ(5, GetValueCacheStats().string_misses);
+
+  DisableValueCache();
+  stats = GetValueCacheStats();
+  EXPECT_EQ(0, stats.int_hits);
+  EXPECT_EQ(0, stats.string_entries);
+  EXPECT_NE(Int(300).GetRef(), Int(300).GetRef());
+  EXPECT_EQ("aa", a.ToString());
+
+  config.int_min = 1;
+  config.int_max = 0;
+  EXPECT_THROW(EnableValueCache(config), std::out_of_range);
+  config.int_min = std::numeric_limits<long>::min();
+  config.int_max = std::numeric_limits<long>::max();
+  EXPECT_THROW(EnableValueCache(config), std::out_of_range);
+  config.int_min = std::numeric_limits<long>::max() - 1;
+  EnableValueCache(config);
+  EXPECT_EQ(Int(config.int_max).GetRef(), Int(config.int_max).GetRef());
+  DisableValueCache();
+}
+
+TEST_F(Test, View) {
+  const char text[] = "hello\0world";
+  auto t0 = Value::FromString(text, sizeof(text) - 1);
+  EXPECT_EQ(11, t0.ToStringView().size());
+  EXPECT_EQ(std::string_view(text, sizeof(text) - 1), t0.ToStringView());
+  EXPECT_EQ(std::string(text, sizeof(text) - 1), t0.ToString());
+  EXPECT_EQ(t0.ToStringView().data(), t0.ToStringView().data());
+  EXPECT_EQ("hel", Str(text, 3).ToStringView());
+  EXPECT_EQ(11, Value::FromString(std::string(text, sizeof(text) - 1)).ToStringView().size());
+  EXPECT_THROW(Value::FromString(std::string("\xff")), std::bad_cast);
+
+  auto t1 = Bytes('a', 'b', 'c');
+  auto v1 = t1.ToBytesView();
+  EXPECT_EQ(3, v1.size());
+  EXPECT_EQ('b', v1[1]);
+  EXPECT_EQ("abc", std::string(v1.begin(), v1.end()));
+
+  auto t2 = ByteArray('x', 'y');
+  auto v2 = t2.ToByteArrayView();
+  v2[0] = 'z';
+  EXPECT_EQ((std::vector<char>{ 'z', 'y' }), t2.ToByteArray());
+
+  EXPECT_THROW(Int(1).ToStringView(), std::bad_cast);
+  EXPECT_THROW(t0.ToBytesView(), std::bad_cast);
+  EXPECT_THROW(t1.ToByteArrayView(), std::bad_cast);
+  EXPECT_THROW(Value::FromString("\xff", 1), std::bad_cast);
+}
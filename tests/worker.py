@@ -0,0 +1,25 @@
+counter = 0
+
+def increment():
+  global counter
+  counter += 1
+  return counter
+
+def count_primes(n):
+  count = 0
+  for i in range(2, n):
+    if all(i % j for j in range(2, int(i ** 0.5) + 1)):
+      count += 1
+  return count
+
+tenants = {}
+
+def add(key, value):
+  tenants[key] = tenants.get(key, 0) + value
+  return tenants[key]
+
+def export_state(key):
+  return str(tenants.pop(key, 0))
+
+def import_state(key, state):
+  tenants[key] = int(state)